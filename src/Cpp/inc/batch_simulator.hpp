@@ -0,0 +1,138 @@
+#pragma once
+
+/******************************************************************************
+* Declare a struct-of-arrays simulator that plays many tables in lockstep.
+******************************************************************************/
+
+/* Headers
+******************************************************************************/
+// C++ standard library
+#include <cstdint>
+#include <functional>   // For std::function
+#include <span>
+#include <vector>
+// Project headers
+#include "cards.hpp"
+#include "constants.hpp"
+#include "random.hpp"
+#include "storage.hpp"
+
+/* Forward Declarations
+******************************************************************************/
+class BatchSimulator;
+
+/* Declarations
+******************************************************************************/
+struct BatchAction
+{
+    // Data Members
+    constants::Action action = constants::Action::No_Action;
+    unsigned chips = 0;  // Chips pushed by a Bet, Raise or Re_Raise
+};
+
+// Choose an action for every table in tables, writing them to actions
+using BatchPolicy = std::function<void(
+    const BatchSimulator& sim,
+    std::span<const int> tables,
+    std::span<BatchAction> actions)>;
+
+class BatchSimulator
+{
+    /**
+     * Play independent no-limit hands on many tables in lockstep.
+     *
+     * Table and seat state is stored as struct-of-arrays: one flat vector per
+     * field, indexed by table or by table * num_players + seat.  There are no
+     * Player objects or virtual calls.  Every table that is still playing is
+     * always waiting for a decision, and step() gathers all of them and asks
+     * the policy for their actions in a single call, so that a policy can
+     * answer the whole batch at once, e.g. with one neural network forward
+     * pass.
+     *
+     * Each hand starts every seat with the same stack and moves the button
+     * one seat.  Cards are dealt lazily from a packed deck whose random
+     * number stream is keyed by the seed, table and hand number, so the
+     * results do not depend on the number of tables played alongside.
+    */
+public:
+    // Constructors
+    BatchSimulator(
+        int num_tables,
+        int num_players,
+        int hands_per_table,
+        int random_seed = 0,
+        unsigned starting_stack = constants::MAX_BUY_IN,
+        unsigned small_blind = constants::SMALL_BLIND,
+        unsigned big_blind = constants::BIG_BLIND);
+    // Member Functions
+    std::span<const std::uint8_t> board(int table) const;
+    unsigned chips_bet(int table, int seat) const;
+    unsigned chips_to_call(int table) const;
+    GameState game_state(int table) const;
+    std::span<const std::uint8_t> hole_cards(int table, int seat) const;
+    bool is_finished() const;
+    bool is_folded(int table, int seat) const;
+    std::uint8_t legal_actions(int table) const;
+    unsigned min_raise(int table) const;
+    std::uint64_t num_decisions() const;
+    std::uint64_t num_hands() const;
+    int num_players() const;
+    int num_tables() const;
+    int player_to_act(int table) const;
+    unsigned pot(int table) const;
+    constants::Round round(int table) const;
+    std::uint64_t run(const BatchPolicy& policy);
+    unsigned stack(int table, int seat) const;
+    size_t step(const BatchPolicy& policy);
+    std::int64_t winnings(int table, int seat) const;
+private:
+    // Data Members
+    const int m_num_tables;
+    const int m_num_players;
+    const int m_hands_per_table;
+    const int m_random_seed;
+    const unsigned m_starting_stack;
+    const unsigned m_small_blind;
+    const unsigned m_big_blind;
+    std::uint64_t m_num_decisions = 0;
+    std::uint64_t m_num_hands = 0;
+    // Table state, indexed by table
+    std::vector<constants::Round> m_round;  // Game_Result once finished
+    std::vector<int> m_hands_played;
+    std::vector<int> m_button;
+    std::vector<int> m_to_act;
+    std::vector<unsigned> m_current_bet;  // Largest bet of the round
+    std::vector<unsigned> m_min_raise;
+    std::vector<unsigned> m_pot;
+    std::vector<std::uint8_t> m_raise_active;  // Raised since the first bet
+    std::vector<std::uint8_t> m_legal_actions;  // Bit i is Legal_Actions[i]
+    std::vector<std::uint8_t> m_board;  // MAX_CARDS_IN_HAND per table
+    std::vector<std::uint8_t> m_board_size;
+    std::vector<PackedDeck> m_decks;
+    std::vector<std::uint8_t> m_deck_top;
+    std::vector<StreamRng> m_deck_rngs;
+    // Seat state, indexed by table * num_players + seat
+    std::vector<unsigned> m_stacks;
+    std::vector<unsigned> m_bets;  // Chips bet this round
+    std::vector<unsigned> m_committed;  // Chips bet this hand
+    std::vector<std::uint8_t> m_hole_cards;  // Two per seat
+    std::vector<std::uint8_t> m_folded;
+    std::vector<std::uint8_t> m_all_in;
+    std::vector<std::uint8_t> m_needs_action;
+    std::vector<std::uint8_t> m_can_raise;
+    std::vector<std::int64_t> m_winnings;
+    // Scratch storage for step()
+    std::vector<int> m_pending;
+    std::vector<BatchAction> m_actions;
+    // Member Functions
+    void m_advance(int table, int seat);
+    void m_apply_action(int table, const BatchAction& action);
+    std::uint8_t m_deal_card(int table);
+    void m_determine_legal_actions(int table);
+    void m_finish_hand(int table);
+    void m_push_chips(int table, int seat, unsigned chips);
+    void m_showdown(int table);
+    void m_start_hand(int table);
+    void m_start_round(int table);
+    int m_seat(int table, int seat) const;
+};
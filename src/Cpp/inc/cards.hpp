@@ -8,10 +8,14 @@
 ******************************************************************************/
 // C++ standard library
 #include <array>
-#include <random> // For shuffle() and mt19937
+#include <cstddef>
+#include <cstdint>
+#include <random>   // For uniform_int_distribution<>
+#include <utility>  // For std::swap()
 #include <vector>
 // Project headers
 #include "constants.hpp"
+#include "random.hpp"
 
 /* Declarations
 ******************************************************************************/
@@ -30,26 +34,102 @@ struct Card
     friend std::ostream& operator<<(std::ostream& os, const Card& c);
 };
 
+// Deck of compact card indices, one byte per card
+using PackedDeck = std::array<std::uint8_t, constants::NUMBER_CARDS_IN_DECK>;
+
+int card_index(const Card& c);
+Card index_to_card(int idx);
+
+template<typename T, typename URBG>
+void partial_shuffle(T* cards, int num_cards, int num_draws, URBG& rng)
+{
+    /**
+     * Shuffle only the first num_draws of num_cards cards.
+     *
+     * Each of the first num_draws positions receives a uniformly random card
+     * from the ones that remain, as in the first steps of a Fisher-Yates
+     * shuffle.  The rest of the cards are left in an arbitrary order.
+    */
+    for (int i = 0; i < num_draws; i++)
+    {
+        std::uniform_int_distribution<int> dist(i, num_cards - 1);
+        std::swap(cards[i], cards[dist(rng)]);
+    }
+}
+
+struct CardMask
+{
+    /**
+     * Bitmask representation of a set of cards.
+     *
+     * Each suit is a 13-bit mask where bit 0 is a Two and bit 12 is an Ace.
+    */
+    // Data Members
+    std::array<std::uint16_t, constants::NUMBER_SUITS> suit_ranks = { 0 };
+    // Member Functions
+    void add_card(const Card& c);
+    void add_card_index(int idx)
+    {
+        suit_ranks[idx / constants::NUMBER_CARDS_IN_SUIT] |= static_cast<
+            std::uint16_t>(1u << (idx % constants::NUMBER_CARDS_IN_SUIT));
+    }
+    void clear();
+    bool contains(const Card& c) const;
+    std::uint16_t rank_mask() const;
+};
+
+class Board
+{
+    /**
+     * Community cards shared by every player at a table.
+     *
+     * The cards are stored once per table rather than copied into each
+     * player's hand.  A card mask of every prefix of the board is kept as
+     * well, so that a hand can be evaluated against the board as it was when
+     * its player folded.
+    */
+public:
+    // Constructors
+    Board() {}
+    // Member Functions
+    void add_card(const Card& c);
+    const CardMask& card_mask(size_t num_cards) const
+    {
+        return m_masks[num_cards];
+    }
+    void clear();
+    size_t size() const { return m_num_cards; }
+    const Card& operator[](size_t idx) const { return m_cards[idx]; }
+private:
+    // Data Members
+    std::array<Card, constants::MAX_CARDS_IN_HAND> m_cards;
+    std::array<CardMask, constants::MAX_CARDS_IN_HAND + 1> m_masks;
+    size_t m_num_cards = 0;
+};
+
 class Deck
 {
 public:
     // Constructors
-    Deck(std::mt19937& rng) : rng(rng)
+    Deck(const StreamRng& rng = StreamRng()) : rng(rng)
     {
         m_build_deck();
     }
     // Data Members
-    std::mt19937 rng;
+    StreamRng rng;
     // Member Functions
     void burn_one_card();
     Card deal_one_card();
     void print_cards();
     void shuffle_deck();
+    void shuffle_deck(int num_cards);
+    void shuffle_deck(constants::DealMode mode);
     void stack_the_deck(std::vector<Card> cards);
 private:
     // Data Members
     int m_top_card_idx = 0;
-    std::array<Card, constants::NUMBER_CARDS_IN_DECK> m_cards;
+    bool m_lazy_deal = false;  // Cards are drawn at random as they are dealt
+    PackedDeck m_cards;
     // Member Functions
     void m_build_deck();
 };
@@ -65,6 +145,7 @@ public:
     std::vector<Card> available_cards;
     constants::HandRank hand_rank = constants::HandRank::High_Card;
     std::array<Card, constants::MAX_CARDS_IN_HAND> best_hand;
+    std::uint32_t hand_strength = 0;
     // Member Functions
     void add_card(const Card c);
     void clear_hand();
@@ -75,20 +156,22 @@ public:
     static bool card_sorter(const Card& lhs, const Card& rhs);
     static bool reverse_card_sorter(const Card& lhs, const Card& rhs);
 private:
-    // Data Members
-    std::vector<Card> d, h, c, s, flush_hand, straight_hand, high_hand;
     // Member Functions
     void m_sort_cards();
-    bool m_is_one_pair();
-    bool m_is_two_pair();
-    bool m_is_three_of_a_kind();
-    bool m_is_wheel_straight();
-    bool m_is_wheel_straight(std::vector<Card> hand);
-    bool m_is_straight();
-    bool m_is_straight(std::vector<Card> hand);
-    bool m_is_flush();
-    bool m_is_full_house();
-    bool m_is_four_of_a_kind();
-    bool m_is_wheel_straight_flush(std::vector<Card> hand);
-    bool m_is_straight_flush(std::vector<Card> hand);
+    bool m_is_one_pair(std::vector<Card>& high_hand) const;
+    bool m_is_two_pair(std::vector<Card>& high_hand) const;
+    bool m_is_three_of_a_kind(std::vector<Card>& high_hand) const;
+    bool m_is_wheel_straight(std::vector<Card>& straight_hand) const;
+    bool m_is_wheel_straight(
+        std::vector<Card> hand, std::vector<Card>& straight_hand) const;
+    bool m_is_straight(std::vector<Card>& straight_hand) const;
+    bool m_is_straight(
+        std::vector<Card> hand, std::vector<Card>& straight_hand) const;
+    bool m_is_flush(std::vector<Card>& flush_hand) const;
+    bool m_is_full_house(std::vector<Card>& high_hand) const;
+    bool m_is_four_of_a_kind(std::vector<Card>& high_hand) const;
+    bool m_is_wheel_straight_flush(
+        std::vector<Card> hand, std::vector<Card>& straight_hand) const;
+    bool m_is_straight_flush(
+        std::vector<Card> hand, std::vector<Card>& straight_hand) const;
 };
\ No newline at end of file
@@ -7,6 +7,8 @@
 /* Headers
 ******************************************************************************/
 // C++ standard library
+#include <array>
+#include <cstdint>
 #include <map>
 
 /* Global Constants
@@ -24,11 +26,37 @@ namespace constants
     inline constexpr int NUMBER_CARDS_IN_DECK = 52;
     inline constexpr int NUMBER_CARDS_IN_SUIT = 13;
     inline constexpr int NUMBER_SUITS = 4;
+    // Compact index of a blank card; real cards are numbered 0-51
+    inline constexpr int NO_CARD_INDEX = NUMBER_CARDS_IN_DECK;
     inline constexpr int MAX_CARDS_IN_HAND = 5;
+    inline constexpr int MAX_AVAILABLE_CARDS = 7;  // Hole cards plus board
     inline constexpr int MAX_CONSOLE_LINES = 5;
     inline constexpr int NN_VECTOR_SIZE = 68;
     inline constexpr int NN_INPUT_SIZE = 60;
     inline constexpr int LEGAL_ACTION_COUNT = 7;
+    // Evaluate hands with the table-driven evaluator instead of the original
+    // Hand::determine_best_hand() implementation
+    inline constexpr bool USE_LOOKUP_EVALUATOR = true;
+    // Evaluate batches of hands with AVX2 when the processor supports it
+    inline constexpr bool USE_SIMD_EVALUATOR = true;
+    inline constexpr int NUM_HOLE_CARD_CLASSES = 169;
+    inline constexpr int MIN_PLAYER_COUNT = 2;
+    inline constexpr unsigned PREFLOP_TABLE_VERSION = 1;
+    inline constexpr char PREFLOP_TABLE_PATH[] =
+        "recorded_games/tables/preflop_equity.bin";
+    inline constexpr size_t EQUITY_CACHE_CAPACITY = 1 << 16;
+    // Random number streams a parallel equity query is split into
+    inline constexpr int EQUITY_ROLLOUT_STREAMS = 16;
+    inline constexpr unsigned TOURNAMENT_FILE_VERSION = 3;
+    inline constexpr std::uint32_t ENDIAN_MARKER = 0x01020304;
+    inline constexpr unsigned DATASET_FILE_VERSION = 1;
+    // Increment whenever the layout of the NN inputs or labels changes
+    inline constexpr unsigned NN_FEATURE_SCHEMA_VERSION = 1;
+    inline constexpr size_t INFERENCE_MAX_BATCH_SIZE = 64;
+    inline constexpr int INFERENCE_MAX_WAIT_US = 200;
+    inline constexpr char NN_MODEL_NAME[] = "traced_poker_model";
+    inline constexpr char NN_MODEL_PATH[] =
+        "recorded_games/models/traced_poker_model.pt";
 
     const std::map<unsigned, std::pair<unsigned, unsigned>> BLINDS_STRUCTURE
     {
@@ -201,6 +229,22 @@ namespace constants
         Not_Playable    // Cards are not worth playing
     };
 
+    enum class RngStream : int
+    {
+        Deck,           // Shuffles the deck at the start of a game
+        Player,         // Random choices of the player to act
+        Rollout,        // Monte Carlo rollouts of the player to act
+        Monte_Carlo     // Deals of TexasHoldEm::begin_mc_game()
+    };
+
+    enum class DealMode : int
+    {
+        Full_Shuffle,   // Shuffle all 52 cards before each game
+        Lazy            // Draw each card from the rest of the deck when dealt
+    };
+    // Full_Shuffle reproduces tournaments recorded before lazy dealing
+    inline constexpr DealMode DEFAULT_DEAL_MODE = DealMode::Full_Shuffle;
+
     enum class PlayStyle : int
     {
         TAG,            // Tight aggressive style
@@ -0,0 +1,48 @@
+#pragma once
+
+/******************************************************************************
+* Declare the exporter that converts tournament files into a training dataset.
+******************************************************************************/
+
+/* Headers
+******************************************************************************/
+// C++ standard library
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+// Project headers
+#include "constants.hpp"
+
+/* Declarations
+******************************************************************************/
+struct DatasetFileHeader
+{
+    /**
+     * Header at the start of an exported neural network dataset file.
+     *
+     * The header is followed by a row-major num_rows x num_columns array of
+     * float32 values.  The first num_inputs columns of each row are the
+     * neural network inputs and the rest are the labels.  The header is 64
+     * bytes long so the array can be memory-mapped from NumPy at offset 64.
+    */
+    // Data Members
+    char magic[4];
+    std::uint32_t version;
+    std::uint32_t endian_marker;
+    std::uint32_t feature_schema_version;
+    std::uint32_t num_columns;
+    std::uint32_t num_inputs;
+    std::uint32_t value_size;   // Bytes per value
+    std::uint32_t reserved;
+    std::uint64_t num_rows;
+    char padding[24];
+};
+static_assert(sizeof(DatasetFileHeader) == 64);
+
+std::vector<std::string> list_tournament_files(const std::string& directory);
+size_t count_nn_rows(const std::string& filename);
+size_t export_nn_dataset(
+    const std::vector<std::string>& filenames,
+    const std::string& write_filename,
+    unsigned num_threads);
@@ -40,6 +40,17 @@ extern "C"
     };
     void get_tournament_summary(struct tournament_summary* summary, char filename[]);
     void write_nn_vector_data(char read_filename[], char write_filename[]);
+    size_t export_nn_dataset(
+        char tourn_directory[],
+        char write_filename[],
+        unsigned num_processors
+    );
+    int generate_preflop_table(
+        char filename[],
+        int num_runs,
+        int seed,
+        unsigned num_processors
+    );
 }
 
 struct tourn_data
@@ -101,4 +112,4 @@ struct tourn_data
     bool debug;
 };
 
-void run_tournament_thread(int thread_index, tourn_data data);
\ No newline at end of file
+void run_tournament(int tournament_number, const tourn_data& data);
\ No newline at end of file
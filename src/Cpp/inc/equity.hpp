@@ -0,0 +1,119 @@
+#pragma once
+
+/******************************************************************************
+* Declare a standalone equity calculator.
+******************************************************************************/
+
+/* Headers
+******************************************************************************/
+// C++ standard library
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <random> // For mt19937
+#include <unordered_map>
+#include <utility> // For pair
+#include <vector>
+// Project headers
+#include "cards.hpp"
+#include "constants.hpp"
+#include "random.hpp"
+#include "thread_pool.hpp"
+
+/* Declarations
+******************************************************************************/
+struct EquityResult
+{
+    /**
+     * Outcome of an equity calculation from the hero's point of view.
+     *
+     * A tie is any run where the hero shares the best hand with at least one
+     * opponent, and tie_share is the sum of the hero's fraction of the pot
+     * over all tied runs.  If exact is true, every possible deal was
+     * enumerated once rather than sampled.
+    */
+    // Data Members
+    std::uint64_t num_runs = 0;
+    std::uint64_t wins = 0;
+    std::uint64_t ties = 0;
+    double tie_share = 0;
+    bool exact = false;
+    // Member Functions
+    double equity() const;
+    double win_probability() const;
+    EquityResult& operator+=(const EquityResult& other);
+};
+
+class EquityCache
+{
+    /**
+     * Thread-safe, bounded cache of equities keyed by equity_cache_key().
+     *
+     * When full, the least recently used entry is evicted.
+    */
+public:
+    // Constructors
+    EquityCache(size_t capacity = constants::EQUITY_CACHE_CAPACITY) :
+        m_capacity(capacity) {}
+    // Member Functions
+    void clear();
+    std::uint64_t hits() const;
+    void insert(std::uint64_t key, double equity);
+    bool lookup(std::uint64_t key, double& equity);
+    std::uint64_t misses() const;
+    size_t size() const;
+private:
+    // Data Members
+    size_t m_capacity;
+    mutable std::mutex m_mutex;
+    std::list<std::pair<std::uint64_t, double>> m_entries;
+    std::unordered_map<std::uint64_t,
+        std::list<std::pair<std::uint64_t, double>>::iterator> m_index;
+    std::atomic<std::uint64_t> m_hits = 0;
+    std::atomic<std::uint64_t> m_misses = 0;
+};
+
+template<typename URBG>
+EquityResult calculate_equity(
+    const std::pair<Card, Card>& hole_cards,
+    const std::vector<Card>& board,
+    int num_opponents,
+    int num_runs,
+    URBG& rng);
+template<typename URBG>
+EquityResult sample_equity(
+    const std::pair<Card, Card>& hole_cards,
+    const std::vector<Card>& board,
+    int num_opponents,
+    int num_runs,
+    URBG& rng);
+EquityResult calculate_equity(
+    const std::pair<Card, Card>& hole_cards,
+    const std::vector<Card>& board,
+    int num_opponents,
+    int num_runs,
+    const StreamRng& rng,
+    ThreadPool* pool);
+EquityResult sample_equity(
+    const std::pair<Card, Card>& hole_cards,
+    const std::vector<Card>& board,
+    int num_opponents,
+    int num_runs,
+    const StreamRng& rng,
+    ThreadPool* pool);
+EquityResult enumerate_equity(
+    const std::pair<Card, Card>& hole_cards,
+    const std::vector<Card>& board,
+    int num_opponents);
+void canonicalize_suits(
+    std::pair<Card, Card>& hole_cards,
+    std::vector<Card>& board);
+std::uint64_t equity_cache_key(
+    const std::pair<Card, Card>& hole_cards,
+    const std::vector<Card>& board,
+    int num_opponents,
+    int num_runs);
+EquityCache& flop_equity_cache();
+void set_equity_threads(unsigned num_threads);
+ThreadPool* equity_thread_pool();
@@ -0,0 +1,50 @@
+#pragma once
+
+/******************************************************************************
+* Declare a table-driven poker hand evaluator.
+******************************************************************************/
+
+/* Headers
+******************************************************************************/
+// C++ standard library
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>  // For std::pair
+#include <vector>
+// Project headers
+#include "cards.hpp"
+#include "constants.hpp"
+
+/* Declarations
+******************************************************************************/
+struct HandStrength
+{
+    /**
+     * Comparable strength of a poker hand.
+     *
+     * The key packs the hand category into bits 20-23, followed by the ranks
+     * of the five cards of the best hand in order of significance (four bits
+     * each).  A larger key is always a stronger hand, and equal keys are tied.
+    */
+    std::uint32_t key = 0;
+    constants::HandRank hand_rank = constants::HandRank::High_Card;
+};
+
+HandStrength evaluate_hand(const CardMask& mask);
+HandStrength evaluate_hand(const std::vector<Card>& cards);
+void evaluate_hands(
+    const CardMask& board,
+    const CardMask* hole_cards,
+    size_t num_hands,
+    std::uint32_t* keys);
+std::vector<std::uint32_t> evaluate_hands(
+    const std::vector<Card>& board,
+    const std::vector<std::pair<Card, Card>>& hole_cards);
+std::uint32_t hand_strength_key(
+    const std::array<Card, constants::MAX_CARDS_IN_HAND>& best_hand);
+std::array<Card, constants::MAX_CARDS_IN_HAND> select_best_hand(
+    std::span<const Card> cards,
+    const HandStrength& strength);
+int suit_index(constants::Suit suit);
@@ -0,0 +1,136 @@
+#pragma once
+
+/******************************************************************************
+* Declare a broker that batches neural network inference across tables.
+******************************************************************************/
+
+/* Headers
+******************************************************************************/
+// C++ standard library
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <exception>    // For exception_ptr
+#include <future>       // For promise, shared_future
+#include <map>
+#include <memory>       // For shared_ptr
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+// Project headers
+#include "batch_simulator.hpp"
+#include "constants.hpp"
+#include "storage.hpp"
+#include <torch/script.h> // One-stop header.
+
+/* Declarations
+******************************************************************************/
+struct InferenceResult
+{
+    // Data Members
+    std::array<float, constants::LEGAL_ACTION_COUNT> action_logits{};
+    float bet = 0;  // Fraction of the player's chips to bet
+};
+
+class InferenceBroker
+{
+    /**
+     * Batch the decisions of every neural network player into one forward
+     * pass.
+     *
+     * Players call infer() from any thread and block until their result is
+     * ready.  Each game state is encoded straight into its row of the batch
+     * input tensor.  A worker thread runs the model as soon as max_batch_size
+     * requests are pending, or max_wait after the oldest pending request
+     * arrived, whichever comes first.
+     *
+     * Each caller blocks its thread, so a batch can never hold more requests
+     * than there are calling threads.  Threads register with add_caller(),
+     * and while any are registered the batch is also sent as soon as every
+     * registered thread is waiting, instead of after max_wait.
+    */
+public:
+    // Constructors
+    InferenceBroker(
+        torch::jit::script::Module module,
+        size_t max_batch_size = constants::INFERENCE_MAX_BATCH_SIZE,
+        std::chrono::microseconds max_wait =
+        std::chrono::microseconds(constants::INFERENCE_MAX_WAIT_US));
+    InferenceBroker(const InferenceBroker&) = delete;
+    InferenceBroker& operator=(const InferenceBroker&) = delete;
+    ~InferenceBroker();
+    // Member Functions
+    void add_caller();
+    InferenceResult infer(const GameState& gs);
+    std::vector<InferenceResult> infer(const std::vector<GameState>& states);
+    size_t num_batches() const;
+    void remove_caller(std::thread::id caller);
+private:
+    struct Request
+    {
+        const GameState* state;
+        InferenceResult result;
+        std::exception_ptr error;
+        bool done = false;
+    };
+    // Data Members
+    torch::jit::script::Module m_module;
+    const size_t m_max_batch_size;
+    const std::chrono::microseconds m_max_wait;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_request_cv;
+    std::condition_variable m_result_cv;
+    std::vector<Request*> m_pending;
+    std::chrono::steady_clock::time_point m_oldest_request;
+    std::map<std::thread::id, size_t> m_callers;  // Registrations per thread
+    size_t m_num_batches = 0;
+    bool m_stop = false;
+    std::thread m_worker;
+    // Member Functions
+    bool m_is_batch_full() const;
+    void m_run_batch(std::vector<Request*>& batch);
+    void m_serve();
+};
+
+class ModelRegistry
+{
+    /**
+     * Process-wide set of named TorchScript models.
+     *
+     * Each model file is loaded once, the first time a name that refers to
+     * it is requested, and its weights are shared by every player in every
+     * thread through one InferenceBroker.  Several names may be registered
+     * at the same time, including names that refer to the same file.
+    */
+public:
+    // Constructors
+    ModelRegistry() {}
+    ModelRegistry(const ModelRegistry&) = delete;
+    ModelRegistry& operator=(const ModelRegistry&) = delete;
+    // Member Functions
+    void add(const std::string& name, const std::string& path);
+    std::shared_ptr<InferenceBroker> get(const std::string& name);
+    bool is_loaded(const std::string& name) const;
+    double load_time_ms(const std::string& name) const;
+    std::vector<std::string> names() const;
+private:
+    struct Model
+    {
+        std::shared_future<std::shared_ptr<InferenceBroker>> broker;
+        bool loaded = false;
+        double load_time_ms = 0;
+    };
+    // Data Members
+    mutable std::mutex m_mutex;
+    std::map<std::string, std::string> m_paths;  // Model name to file path
+    std::map<std::string, Model> m_models;  // Model file path to model
+    // Member Functions
+    void m_load(
+        const std::string& name,
+        const std::string& path,
+        std::promise<std::shared_ptr<InferenceBroker>>& broker);
+};
+
+BatchPolicy neural_network_policy(std::shared_ptr<InferenceBroker> broker);
+ModelRegistry& model_registry();
@@ -36,7 +36,9 @@ void format_table(tabulate::Table& player_table, const GameState& gs);
 void print_table(const GameState& gs);
 void print_console_output(const GameState& gs);
 void print_state(const GameState& gs);
-void playback_tournament(TournamentHistory& th);
+void playback_game(const GameHistory& game);
+void playback_tournament(TournamentHistory& th, size_t start_game = 0);
+void playback_tournament(std::string filename, size_t start_game = 0);
 
 
 
@@ -9,17 +9,21 @@
 // C++ standard library
 #include <array>
 #include <memory>   // For shared_ptr
-#include <random>   // For mt19937 and normal distribution
+#include <random>   // For uniform distributions
+#include <string>
+#include <thread>   // For thread::id
 #include <utility>  // For std::pair
 #include <vector>
 // Project headers
 #include "cards.hpp"
 #include "constants.hpp"
+#include "random.hpp"
 #include <torch/script.h> // One-stop header.
 
 /* Forward Declarations
 ******************************************************************************/
 struct GameState;
+class InferenceBroker;
 class TexasHoldEm;
 
 /* AI Declarations
@@ -28,11 +32,11 @@ class PlayerAI
 {
 public:
     // Constructors
-    PlayerAI(std::mt19937& rng) : rng(rng) {}
+    PlayerAI(const StreamRng& rng) : rng(rng) {}
     // Destructor
     virtual ~PlayerAI() = default;
     // Data Members
-    std::mt19937& rng;
+    StreamRng rng;  // Reseeded before every action
     // Member Functions
     virtual void player_act(GameState& gs) = 0;
     static bool legal_act(constants::Action act, GameState& gs);
@@ -42,7 +46,7 @@ class RandomAI : public PlayerAI
 {
 public:
     // Constructors
-    RandomAI(std::mt19937& rng) : PlayerAI(rng) {}
+    RandomAI(const StreamRng& rng) : PlayerAI(rng) {}
     // Data Members
     const constants::AI_Type ai = constants::AI_Type::Random;
     // Member Functions
@@ -58,7 +62,7 @@ class ScriptedAI : public PlayerAI
 {
 public:
     // Constructors
-    ScriptedAI(std::mt19937& rng) : PlayerAI(rng) {}
+    ScriptedAI(const StreamRng& rng) : PlayerAI(rng) {}
     // Data Members
     const constants::AI_Type ai = constants::AI_Type::Scripted;
     std::vector<std::pair<constants::Action, unsigned>> scripted_actions;
@@ -74,7 +78,7 @@ class CheckCallAI : public PlayerAI
 {
 public:
     // Constructors
-    CheckCallAI(std::mt19937& rng) : PlayerAI(rng) {}
+    CheckCallAI(const StreamRng& rng) : PlayerAI(rng) {}
     // Data Members
     const constants::AI_Type ai = constants::AI_Type::CheckCall;
     // Member Functions
@@ -85,7 +89,7 @@ class HeuristicAI : public PlayerAI
 {
 public:
     // Constructors
-    HeuristicAI(std::mt19937& rng,
+    HeuristicAI(const StreamRng& rng,
         constants::PlayStyle play_style) :
         PlayerAI(rng),
         play_style(play_style)
@@ -94,6 +98,7 @@ public:
     constants::PlayStyle play_style;
     constants::Position player_position;
     constants::Position hand_position;
+    double hole_card_equity = -1;  // From preflop table, -1 if unavailable
     // Member Functions
     constants::Position assess_hole_cards(GameState& gs);
     constants::Position assess_player_position(GameState& gs);
@@ -113,24 +118,21 @@ class NeuralNetworkAI : public PlayerAI
 {
 public:
     // Constructors
-    NeuralNetworkAI(std::mt19937& rng) :
-        PlayerAI(rng)
-    {
-        try {
-            // Deserialize the ScriptModule from a file using torch::jit::load().
-            module = torch::jit::load(model_path);
-        }
-        catch (const c10::Error& e) {
-            std::cerr << "error loading the model\n";
-        }
-    }
+    NeuralNetworkAI(
+        const StreamRng& rng,
+        const std::string& model_name = constants::NN_MODEL_NAME);
+    NeuralNetworkAI(const NeuralNetworkAI&) = delete;
+    NeuralNetworkAI& operator=(const NeuralNetworkAI&) = delete;
+    ~NeuralNetworkAI();
     // Data Members
-    const char model_path[100] = "recorded_games/models/traced_poker_model.pt";
-    torch::jit::script::Module module;
     const constants::AI_Type ai = constants::AI_Type::NeuralNetworkAI;
     // Member Functions
     void player_act(GameState& gs) override;
     unsigned round_bet(double bet);
+private:
+    // Data Members
+    std::shared_ptr<InferenceBroker> m_broker;
+    std::thread::id m_caller_thread;  // Thread registered with the broker
 };
 
 /* Player Declarations
@@ -139,7 +141,11 @@ class Player
 {
 public:
     // Constructors
-    Player(int idx, unsigned chips, constants::AI_Type ai, std::mt19937& rng) :
+    Player(
+        int idx,
+        unsigned chips,
+        constants::AI_Type ai,
+        const StreamRng& rng) :
         player_idx(idx),
         ai_type(ai),
         m_chip_count(chips)
@@ -153,13 +159,14 @@ public:
     constants::Action prev_action = constants::Action::No_Action;
     // Member Functions
     void eliminate_player();
-    void fold_player();
+    void fold_player(const Board& board);
     constants::Blind get_blind_status() const;
     std::pair<Card, Card> get_hole_cards();
-    std::vector<Card> get_available_cards();
-    std::array<Card, constants::MAX_CARDS_IN_HAND> get_best_hand();
-    constants::HandRank get_best_hand_rank();
-    size_t get_card_count() const;
+    std::vector<Card> get_available_cards(const Board& board) const;
+    std::array<Card, constants::MAX_CARDS_IN_HAND> get_best_hand(
+        const Board& board);
+    constants::HandRank get_best_hand_rank(const Board& board);
+    size_t get_card_count(const Board& board) const;
     unsigned get_chip_count() const;
     unsigned pay_blind(unsigned chips);
     void player_act(GameState& gs);
@@ -167,6 +174,7 @@ public:
     bool is_player_eliminated() const;
     void receive_card(const Card& c);
     void return_cards();
+    void seed_ai(const StreamRng& rng);
     void set_player_active();
     void update_blind_status(constants::Blind b);
     void win_chips(unsigned chips);
@@ -176,11 +184,22 @@ private:
     friend TexasHoldEm;
     // Data Members
     std::shared_ptr<PlayerAI> m_ai;
-    Hand m_hand;
+    std::pair<Card, Card> m_hole_cards;
+    size_t m_num_hole_cards = 0;
+    // Number of community cards the player saw before folding
+    size_t m_board_cards_seen = constants::MAX_CARDS_IN_HAND;
+    // Best hand of the player's cards with the first m_evaluated_cards of the
+    // board, cached until the player can see more of the board
+    bool m_is_evaluated = false;
+    size_t m_evaluated_cards = 0;
+    std::array<Card, constants::MAX_CARDS_IN_HAND> m_best_hand;
+    constants::HandRank m_hand_rank = constants::HandRank::High_Card;
     bool m_active = true;
     bool m_eliminated = false;
     unsigned m_chip_count;
     // Member Functions
+    void m_evaluate_hand(const Board& board);
     unsigned m_push_chips_to_pot(unsigned chips);
-    void m_select_ai(std::mt19937& rng);
+    void m_select_ai(const StreamRng& rng);
+    size_t m_visible_board_cards(const Board& board) const;
 };
\ No newline at end of file
@@ -8,11 +8,11 @@
 ******************************************************************************/
 // C++ standard library
 #include <array>
-#include <random> // For mt19937 and uniform distribution
 #include <vector>
 // Project headers
 #include "constants.hpp"
 #include "cards.hpp"
+#include "random.hpp"
 
 /* Forward Declarations
 ******************************************************************************/
@@ -47,25 +47,23 @@ class Dealer
 {
 public:
     // Constructors
-    Dealer(std::mt19937& rng) : m_deck(rng) {}
+    Dealer() {}
     // Data Members
-    Card flop_card1;
-    Card flop_card2;
-    Card flop_card3;
-    Card turn_card;
-    Card river_card;
+    Board board;  // Community cards shared by every player at the table
     // Member Functions
     void burn_one_card();
     void clear_cards_from_table();
     Card deal_one_card();
-    void shuffle_deck();
+    void shuffle_deck(
+        const StreamRng& rng,
+        constants::DealMode mode = constants::DEFAULT_DEAL_MODE);
     void deal_to_players(
         std::vector<Player>& player_list,
         int num_players,
         int button_idx);
-    void deal_flop(std::vector<Player>& player_list);
-    void deal_turn(std::vector<Player>& player_list);
-    void deal_river(std::vector<Player>& player_list);
+    void deal_flop();
+    void deal_turn();
+    void deal_river();
     void stack_the_deck(std::vector<Card> cards);
 private:
     // Data Members
@@ -0,0 +1,53 @@
+#pragma once
+
+/******************************************************************************
+* Declare the precomputed preflop equity table.
+******************************************************************************/
+
+/* Headers
+******************************************************************************/
+// C++ standard library
+#include <array>
+#include <string>
+#include <utility> // For pair
+// Project headers
+#include "cards.hpp"
+#include "constants.hpp"
+
+/* Declarations
+******************************************************************************/
+class PreflopEquityTable
+{
+    /**
+     * Equity of each of the 169 hole card classes at each table size.
+     *
+     * A hole card class is a pocket pair, or two ranks that are either suited
+     * or unsuited.  The equity is against random hands of every opponent at
+     * a table of 2 to 10 players, and lookups are O(1).
+    */
+public:
+    // Constructors
+    PreflopEquityTable() {}
+    // Data Members
+    unsigned num_runs = 0;  // Simulated deals per table entry
+    // Member Functions
+    float equity(const Card& c1, const Card& c2, int num_players) const;
+    float equity(int hand_class, int num_players) const;
+    bool is_loaded() const;
+    bool load(const std::string& filename);
+    bool save(const std::string& filename) const;
+    void set_equity(int hand_class, int num_players, float equity);
+private:
+    // Data Members
+    std::array<float, constants::NUM_HOLE_CARD_CLASSES *
+        (constants::MAX_PLAYER_COUNT - constants::MIN_PLAYER_COUNT + 1)>
+        m_equity{};
+};
+
+int hole_card_class(const Card& c1, const Card& c2);
+std::pair<Card, Card> hole_card_class_example(int hand_class);
+PreflopEquityTable generate_preflop_equity_table(
+    int num_runs,
+    int seed,
+    unsigned num_threads);
+const PreflopEquityTable& preflop_equity_table();
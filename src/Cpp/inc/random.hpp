@@ -0,0 +1,93 @@
+#pragma once
+
+/******************************************************************************
+* Declare a counter-based random number generator with keyed sub-streams.
+******************************************************************************/
+
+/* Headers
+******************************************************************************/
+// C++ standard library
+#include <bit>          // For std::popcount()
+#include <cstdint>
+#include <limits>
+#include <utility>      // For std::to_underlying()
+// Project headers
+#include "constants.hpp"
+
+/* Declarations
+******************************************************************************/
+class StreamRng
+{
+    /**
+     * Counter-based random number generator (SplitMix64).
+     *
+     * Output i of a stream is a bit-mixing function of key + i * gamma, so
+     * the generator has no state besides a counter.  Every independent
+     * source of randomness gets its own stream, keyed by the tournament seed
+     * and by where it is used (the tournament, game and action numbers and
+     * a purpose), and nothing depends on the order in which threads draw
+     * numbers.  Each output costs a few multiplies and shifts, which is
+     * cheaper than std::mt19937 and needs 24 bytes instead of 5 KB.
+     *
+     * Satisfies UniformRandomBitGenerator, so it can be used with the
+     * standard distributions and std::shuffle().
+    */
+public:
+    using result_type = std::uint64_t;
+    // Constructors
+    explicit StreamRng(std::uint64_t seed = 0) :
+        m_key(mix(seed)), m_gamma(mix_gamma(seed)) {}
+    StreamRng(
+        std::uint64_t seed,
+        constants::RngStream stream,
+        std::uint64_t tournament_number,
+        std::uint64_t game_number,
+        std::uint64_t action_number,
+        std::uint64_t index = 0) :
+        StreamRng(StreamRng(seed)
+            .split(static_cast<std::uint64_t>(std::to_underlying(stream)))
+            .split(tournament_number)
+            .split(game_number)
+            .split(action_number)
+            .split(index)) {}
+    // Member Functions
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max()
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+    result_type operator()() { return mix(m_key + m_gamma * ++m_counter); }
+    std::uint64_t counter() const { return m_counter; }
+    void discard(std::uint64_t n) { m_counter += n; }
+    StreamRng split(std::uint64_t index) const
+    {
+        /**
+         * Return the independent sub-stream number index of this stream.
+         *
+         * The sub-stream depends on this stream's key but not on how many
+         * numbers have been drawn from it.
+        */
+        return StreamRng(m_key ^ mix(m_gamma + index));
+    }
+private:
+    // Data Members
+    std::uint64_t m_key;
+    std::uint64_t m_gamma;  // Odd increment between counter values
+    std::uint64_t m_counter = 0;
+    // Member Functions
+    static constexpr std::uint64_t mix(std::uint64_t z)
+    {
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+    static constexpr std::uint64_t mix_gamma(std::uint64_t seed)
+    {
+        // As in java.util.SplittableRandom, use an odd gamma with enough bit
+        // transitions that consecutive counters don't give similar inputs
+        std::uint64_t z = (seed + 0x9e3779b97f4a7c15ULL) * 0xff51afd7ed558ccdULL;
+        z = (z ^ (z >> 33)) * 0xc4ceb9fe1a85ec53ULL;
+        z = (z ^ (z >> 33)) | 1;
+        return std::popcount(z ^ (z >> 1)) < 24 ? z ^ 0xaaaaaaaaaaaaaaaaULL : z;
+    }
+};
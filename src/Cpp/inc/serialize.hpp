@@ -8,9 +8,11 @@
 ******************************************************************************/
 // C++ standard library
 #include <array>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
 #include <string>
+#include <type_traits> // For has_unique_object_representations
 #include <vector>
 // Project headers
 #include "constants.hpp"
@@ -18,12 +20,212 @@
 
 /* Declarations
 ******************************************************************************/
+struct TournamentFileHeader
+{
+    /**
+     * Fixed-size header at the start of a versioned tournament file.
+     *
+     * The header is followed by each game: a GameRecordHeader and then
+     * num_states GameStateRecords, each written as one block.  The format
+     * version, endianness marker and GameStateRecord size must match the
+     * reader.
+    */
+    // Data Members
+    char magic[4];
+    std::uint32_t version;
+    std::uint32_t endian_marker;
+    std::uint32_t state_size;
+    std::int32_t tournament_number;
+    std::int32_t random_seed;
+    std::int32_t initial_player_count;
+    std::array<constants::AI_Type, constants::MAX_PLAYER_COUNT> player_ai_types;
+    std::array<std::int32_t, constants::MAX_PLAYER_COUNT> finishing_order;
+    std::array<std::int32_t, constants::MAX_PLAYER_COUNT> game_eliminated;
+    std::uint32_t reserved;
+    std::uint64_t num_games;
+};
+
+struct ShowdownRecord
+{
+    /**
+     * Fixed-layout file record of a ShowdownStruct.
+     *
+     * Cards are stored as card indices.  The hand strength key is not
+     * stored, since it is recomputed from the best hand when decoded.
+    */
+    // Data Members
+    std::uint32_t total_chips_bet;
+    std::uint32_t chips_won;
+    std::int8_t player_idx;
+    std::uint8_t hand_rank;
+    std::array<std::uint8_t, constants::MAX_CARDS_IN_HAND> best_hand;
+    std::uint8_t reserved;
+};
+
+struct GameStateRecord
+{
+    /**
+     * Fixed-layout file record of a GameState.
+     *
+     * Every field has an explicit width and the record has no padding, so
+     * its bytes do not depend on the compiler's layout of GameState.  Cards
+     * are stored as card indices, enums as bytes, and the elements beyond
+     * the size of each vector are left zero, so the same game always
+     * produces the same bytes.  Fields are ordered from widest to narrowest.
+    */
+    // Data Members
+    std::array<double, constants::MAX_PLAYER_COUNT> win_perc;
+    std::int32_t random_seed;
+    std::int32_t tournament_number;
+    std::int32_t game_number;
+    std::int32_t num_games_per_blind_level;
+    std::int32_t initial_num_players;
+    std::int32_t num_players;
+    std::int32_t num_active_players;
+    std::int32_t action_number;
+    std::int32_t player_idx;
+    std::int32_t raise_player_idx;
+    std::uint32_t sum_prev_bets;
+    std::uint32_t pot_chip_count;
+    std::uint32_t chips_to_call;
+    std::uint32_t min_bet;
+    std::uint32_t max_bet;
+    std::uint32_t min_to_raise;
+    std::uint32_t player_bet;
+    std::array<std::array<std::uint32_t, constants::MAX_BETTING_ROUNDS>,
+        constants::MAX_PLAYER_COUNT> pot_player_bets;
+    std::array<std::uint32_t, constants::MAX_PLAYER_COUNT> player_chip_counts;
+    std::array<std::int32_t, constants::MAX_PLAYER_COUNT> remaining_players;
+    std::array<std::int32_t, constants::MAX_PLAYER_COUNT> active_player_list;
+    std::array<ShowdownRecord, constants::MAX_PLAYER_COUNT> showdown_players;
+    std::array<std::uint8_t, constants::MAX_PLAYER_COUNT> blinds;
+    std::array<std::uint8_t, constants::MAX_PLAYER_COUNT> last_actions;
+    std::array<std::uint8_t, constants::MAX_PLAYER_COUNT> ai_types;
+    std::array<std::uint8_t, 2 * constants::MAX_PLAYER_COUNT> hole_cards;
+    std::array<std::array<std::uint8_t, constants::MAX_CARDS_IN_HAND>,
+        constants::MAX_PLAYER_COUNT> best_hands;
+    std::array<std::uint8_t, constants::MAX_PLAYER_COUNT> hand_ranks;
+    std::array<std::uint8_t, constants::MAX_CARDS_IN_HAND> best_hand;
+    std::array<std::uint8_t, constants::MAX_AVAILABLE_CARDS> available_cards;
+    std::array<std::uint8_t, constants::LEGAL_ACTION_COUNT> legal_actions;
+    std::array<std::uint8_t, constants::MAX_CARDS_IN_HAND> board_cards;
+    std::uint8_t round;
+    std::uint8_t player_action;
+    std::uint8_t legal_to_raise;
+    std::uint8_t raise_active;
+    std::uint8_t all_in_below_min_raise;
+    // Sizes of the vectors
+    std::uint8_t num_blinds;
+    std::uint8_t num_last_actions;
+    std::uint8_t num_ai_types;
+    std::uint8_t num_hole_cards;
+    std::uint8_t num_best_hands;
+    std::uint8_t num_hand_ranks;
+    std::uint8_t num_remaining_players;
+    std::uint8_t num_player_chip_counts;
+    std::uint8_t num_active_player_list;
+    std::uint8_t num_available_cards;
+    std::uint8_t available_cards_size;
+    std::uint8_t num_legal_actions;
+    std::uint8_t legal_actions_size;
+    std::uint8_t num_win_perc;
+    std::uint8_t num_showdown_players;
+    std::uint8_t showdown_players_size;
+    std::array<std::uint8_t, 9> reserved;
+};
+
+struct GameRecordHeader
+{
+    // Data Members
+    std::int32_t game_number;
+    std::uint32_t reserved;
+    std::uint64_t num_states;
+};
+struct GameIndexEntry
+{
+    // Data Members
+    std::int32_t game_number;
+    std::uint32_t reserved;
+    std::uint64_t offset;  // Byte offset of the game's GameRecordHeader
+    std::uint64_t num_states;
+};
+
+struct GameIndexFooter
+{
+    /**
+     * Last bytes of a completed tournament file.
+     *
+     * The footer is preceded by num_games GameIndexEntry records, one per
+     * game in the order they were played.  Files of tournaments that were
+     * interrupted have no footer.
+    */
+    // Data Members
+    char magic[4];
+    std::uint32_t reserved;
+    std::uint64_t num_games;
+};
+// File records must have no padding, so that every byte written is defined
+static_assert(std::has_unique_object_representations_v<TournamentFileHeader>);
+static_assert(std::has_unique_object_representations_v<GameRecordHeader>);
+static_assert(std::has_unique_object_representations_v<GameIndexEntry>);
+static_assert(std::has_unique_object_representations_v<GameIndexFooter>);
+static_assert(std::has_unique_object_representations_v<ShowdownRecord>);
+// Doubles have no unique representation, so compare with the member sizes
+static_assert(sizeof(GameStateRecord) == 752,
+    "GameStateRecord must have no padding!");
+// Keep GameState records aligned so they can be read in place
+static_assert(sizeof(TournamentFileHeader) % alignof(GameStateRecord) == 0);
+static_assert(sizeof(GameRecordHeader) % alignof(GameStateRecord) == 0);
+
+class TournamentWriter
+{
+    /**
+     * Stream a tournament history to disk one game at a time.
+     *
+     * The header is written when the file is opened, with placeholders for
+     * the results that are only known once the tournament ends.  Each game
+     * is appended as soon as it finishes, and close() patches the finishing
+     * order, game eliminated and number of games into the header and appends
+     * an index of game offsets.  Only the game being played has to be kept in
+     * memory.
+    */
+public:
+    // Member Functions
+    void append_game(GameHistory& gh);
+    void close(TournamentHistory& th);
+    bool is_open() const;
+    void open(std::string filename, TournamentHistory& th);
+private:
+    // Data Members
+    std::ofstream m_fs;
+    TournamentFileHeader m_header;
+    std::vector<GameIndexEntry> m_index;
+};
+
 ShowdownStruct read_showdownstruct(std::ifstream& fs);
 void write_showdownstruct(std::ofstream& fs, ShowdownStruct& sd);
 GameState read_gamestate(std::ifstream& fs);
 void write_gamestate(std::ofstream& fs, GameState& gs);
 GameHistory read_gamehistory(std::ifstream& fs);
 void write_gamehistory(std::ofstream& fs, GameHistory& gh);
+GameStateRecord encode_game_state(const GameState& gs);
+GameState decode_game_state(const GameStateRecord& record);
+GameHistory read_game_record(std::ifstream& fs);
+void write_game_record(std::ofstream& fs, const GameHistory& gh);
+bool check_tournament_file_header(const TournamentFileHeader& header);
+bool read_tournament_file_header(std::ifstream& fs, TournamentFileHeader& header);
+bool check_game_index_footer(
+    const GameIndexFooter& footer,
+    const TournamentFileHeader& header,
+    size_t file_size);
+std::vector<GameIndexEntry> read_game_index(
+    std::ifstream& fs,
+    const TournamentFileHeader& header);
+GameHistory read_game(std::string filename, size_t game_idx);
+std::vector<GameHistory> read_games(
+    std::string filename,
+    size_t first_game,
+    size_t num_games);
 TournamentHistory read_tournamenthistory(
     std::string filename,
     bool summary = false
@@ -32,11 +234,15 @@ void write_tournamenthistory(std::string filename, TournamentHistory& th);
 std::string create_timestamp();
 std::string get_date();
 void write_nn_vector_data(std::string read_filename, std::string write_filename);
-std::vector<double> game_state_to_nn_vector(GameState gs);
+template<typename T>
+void encode_nn_inputs(const GameState& gs, T* inputs);
+template<typename T>
+void encode_nn_labels(const GameState& gs, T* labels);
+std::vector<double> game_state_to_nn_vector(const GameState& gs);
 int return_suit_one_hot(constants::Suit suit);
 unsigned get_total_player_bets(
     int player_idx,
-    std::array<
-    std::array<unsigned, constants::MAX_BETTING_ROUNDS>, constants::MAX_PLAYER_COUNT>
+    const std::array<
+    std::array<unsigned, constants::MAX_BETTING_ROUNDS>, constants::MAX_PLAYER_COUNT>&
     m_player_bets
 );
\ No newline at end of file
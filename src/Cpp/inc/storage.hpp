@@ -7,19 +7,94 @@
 /* Headers
 ******************************************************************************/
 // C++ standard library
+#include <algorithm>   // For std::equal()
 #include <array>
+#include <cassert>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits> // For is_trivially_copyable
+#include <utility>     // For pair
 #include <vector>
 // Project headers
+#include "cards.hpp"
 #include "constants.hpp"
 
 /* Forward Declarations
 ******************************************************************************/
-struct Card;
 class Player;
 class Pot;
 
 /* Declarations
 ******************************************************************************/
+template<typename T, size_t N>
+struct FixedVector
+{
+    /**
+     * Vector-like container with a fixed capacity and no heap allocation.
+     *
+     * Stores up to N elements in a std::array followed by a count, so a
+     * FixedVector of trivially copyable elements is itself trivially
+     * copyable and can be copied with a single memcpy.
+    */
+    // Constructors
+    FixedVector() {}
+    FixedVector(size_t count, const T& value) { resize(count, value); }
+    FixedVector(std::initializer_list<T> values)
+    {
+        for (const auto& value : values) { push_back(value); }
+    }
+    FixedVector(const std::vector<T>& values)
+    {
+        for (const auto& value : values) { push_back(value); }
+    }
+    // Data Members
+    std::array<T, N> elements{};
+    size_t count = 0;
+    // Member Functions
+    T* begin() { return elements.data(); }
+    const T* begin() const { return elements.data(); }
+    void clear() { count = 0; }
+    T* data() { return elements.data(); }
+    const T* data() const { return elements.data(); }
+    bool empty() const { return count == 0; }
+    T* end() { return elements.data() + count; }
+    const T* end() const { return elements.data() + count; }
+    void push_back(const T& value)
+    {
+        assert((count < N) && "FixedVector capacity exceeded!");
+        elements[count++] = value;
+    }
+    void resize(size_t new_count, const T& value = T())
+    {
+        assert((new_count <= N) && "FixedVector capacity exceeded!");
+        for (size_t i = count; i < new_count; i++) { elements[i] = value; }
+        count = new_count;
+    }
+    size_t size() const { return count; }
+    T& operator[](size_t idx) { return elements[idx]; }
+    const T& operator[](size_t idx) const { return elements[idx]; }
+    bool operator==(const FixedVector& other) const
+    {
+        return std::equal(begin(), end(), other.begin(), other.end());
+    }
+};
+
+struct HoleCardPair
+{
+    /**
+     * Trivially copyable replacement for std::pair<Card, Card>.
+    */
+    // Constructors
+    HoleCardPair() {}
+    HoleCardPair(const std::pair<Card, Card>& cards) :
+        first(cards.first), second(cards.second) {}
+    // Data Members
+    Card first;
+    Card second;
+    // Member Functions
+    operator std::pair<Card, Card>() const { return { first, second }; }
+};
+
 struct ShowdownStruct
 {
     // Constructors
@@ -29,18 +104,14 @@ struct ShowdownStruct
         std::array<Card, constants::MAX_CARDS_IN_HAND> sh,
         constants::HandRank hr,
         unsigned chips_bet,
-        unsigned chips_won = 0) :
-        player_idx(idx),
-        best_hand(sh),
-        hand_rank(hr),
-        total_chips_bet(chips_bet),
-        chips_won(chips_won) {}
+        unsigned chips_won = 0);
     // Data Members
     int player_idx;
     std::array<Card, constants::MAX_CARDS_IN_HAND> best_hand;
     constants::HandRank hand_rank;
     unsigned total_chips_bet;
     unsigned chips_won;
+    std::uint32_t hand_strength = 0;  // Packed key, larger is stronger
     // Member Functions
     // Const required when using 3-paremeter version of std::sort
     bool operator>(const ShowdownStruct& other) const;
@@ -69,13 +140,14 @@ struct GameState
     constants::Round round;
     // Player info
     int player_idx;
-    std::vector<constants::Blind> blinds;
-    std::vector<constants::Action> last_actions;
-    std::vector<constants::AI_Type> ai_types;
-    std::vector<std::pair<Card, Card>> hole_cards;
-    std::vector<std::array<Card, constants::MAX_CARDS_IN_HAND>> best_hands;
-    std::vector<constants::HandRank> hand_ranks;
-    std::vector<int> remaining_players;  // Vector bool is broken
+    FixedVector<constants::Blind, constants::MAX_PLAYER_COUNT> blinds;
+    FixedVector<constants::Action, constants::MAX_PLAYER_COUNT> last_actions;
+    FixedVector<constants::AI_Type, constants::MAX_PLAYER_COUNT> ai_types;
+    FixedVector<HoleCardPair, constants::MAX_PLAYER_COUNT> hole_cards;
+    FixedVector<std::array<Card, constants::MAX_CARDS_IN_HAND>,
+        constants::MAX_PLAYER_COUNT> best_hands;
+    FixedVector<constants::HandRank, constants::MAX_PLAYER_COUNT> hand_ranks;
+    FixedVector<int, constants::MAX_PLAYER_COUNT> remaining_players;
     // Before action
     unsigned sum_prev_bets;
     bool legal_to_raise;
@@ -96,21 +168,24 @@ struct GameState
     std::array<
         std::array<unsigned, constants::MAX_BETTING_ROUNDS>, constants::MAX_PLAYER_COUNT>
         pot_player_bets = { 0 };
-    std::vector<unsigned> player_chip_counts;
-    std::vector<int> active_player_list;
+    FixedVector<unsigned, constants::MAX_PLAYER_COUNT> player_chip_counts;
+    FixedVector<int, constants::MAX_PLAYER_COUNT> active_player_list;
     std::array<Card, constants::MAX_CARDS_IN_HAND> best_hand;
     size_t num_available_cards;
-    std::vector<Card> available_cards;
+    FixedVector<Card, constants::MAX_AVAILABLE_CARDS> available_cards;
     size_t num_legal_actions;
-    std::vector<constants::Action> legal_actions;
+    FixedVector<constants::Action, constants::LEGAL_ACTION_COUNT> legal_actions;
     // After action
     constants::Action player_action;
     unsigned player_bet;
-    std::vector<double> win_perc;
+    FixedVector<double, constants::MAX_PLAYER_COUNT> win_perc;
     // After Showdown
     size_t num_showdown_players;
-    std::vector<ShowdownStruct> showdown_players;
+    FixedVector<ShowdownStruct, constants::MAX_PLAYER_COUNT> showdown_players;
 };
+// Snapshots are copied into the game history after every action
+static_assert(std::is_trivially_copyable_v<GameState>,
+    "GameState must be trivially copyable!");
 
 struct GameHistory
 {
@@ -137,7 +212,7 @@ struct TournamentHistory
     std::vector<constants::AI_Type> player_ai_types;
     std::vector<int> finishing_order;
     std::vector<int> game_eliminated;
-    size_t num_games;
+    size_t num_games = 0;
     std::vector<GameHistory> games;
 };
 
@@ -10,12 +10,13 @@
 #include <array>
 #include <cassert>
 #include <deque>
-#include <random> // For mt19937 and uniform distribution
 #include <string>
 #include <vector>
 // Project headers
 #include "constants.hpp"
 #include "pot_dealer.hpp"
+#include "random.hpp"
+#include "serialize.hpp"
 #include "storage.hpp"
 
 /* Forward Declarations
@@ -41,8 +42,8 @@ public:
         initial_num_players(num_players),
         num_players(num_players),
         random_seed(random_seed),
-        rng(random_seed),
-        dealer(rng),
+        rng(random_seed, constants::RngStream::Monte_Carlo, tournament_number,
+            0, 0),
         tournament_number(tournament_number),
         debug(debug),
         num_games_per_blind_level(num_games_per_blind_level),
@@ -58,7 +59,8 @@ public:
                     i,
                     constants::MAX_BUY_IN,
                     player_ai_types[i],
-                    rng));
+                    StreamRng(random_seed, constants::RngStream::Player,
+                        tournament_number, 0, 0, i)));
         }
         // Initalize data storage structures
         tourn_hist.tournament_number = tournament_number;
@@ -74,7 +76,7 @@ public:
     const int random_seed;
     std::vector<Player> full_player_list;
     Pot pot;
-    std::mt19937 rng;
+    StreamRng rng;  // Deals of Monte Carlo games
     Dealer dealer;
     const int tournament_number;
     bool debug;
@@ -83,6 +85,7 @@ public:
     size_t mc_run_wins = 0;
     int num_games_per_blind_level;
     std::string tourn_directory;
+    constants::DealMode deal_mode = constants::DEFAULT_DEAL_MODE;
     // Member Functions
     void begin_tournament();
     void begin_test_game(TestCase tc);
@@ -104,16 +107,19 @@ private:
     TestCase m_test_case;
     GameHistory game_hist;
     TournamentHistory tourn_hist;
+    TournamentWriter m_tourn_writer;
     std::vector<Card> m_partial_deck;
     std::vector<Card> m_mc_deck;
     // Member Functions
-    void m_begin_game(GameState gs);
-    void m_pre_flop(GameState gs);
-    void m_flop(GameState gs);
-    void m_turn(GameState gs);
-    void m_river(GameState gs);
-    void m_showdown(GameState gs);
-    void m_end_game(GameState gs);
+    void m_game_loop(GameState& gs);
+    constants::Round m_begin_game(GameState& gs);
+    constants::Round m_pre_flop(GameState& gs);
+    constants::Round m_flop(GameState& gs);
+    constants::Round m_turn(GameState& gs);
+    constants::Round m_river(GameState& gs);
+    constants::Round m_showdown(GameState& gs);
+    void m_open_tournament_file();
+    bool m_end_game(GameState& gs);
     void m_determine_game_winner(GameState& gs);
     void m_betting_loop(GameState& gs, int starting_player);
     void m_determine_legal_actions(GameState& gs, int plyr_idx);
@@ -127,8 +133,8 @@ private:
     std::vector<int> m_get_vec_active_players() const;
     std::vector<int> m_get_vec_remaining_players() const;
     std::vector<unsigned> m_get_player_chip_counts() const;
-    void m_load_script(GameState gs);
-    void m_validate_test_results(GameState gs);
+    void m_load_script(GameState& gs);
+    void m_validate_test_results(GameState& gs);
     void m_load_mc_deck(GameState gs);
     void m_build_partial_deck(std::vector<Card> exclude);
     void m_build_mc_deck(std::vector<Card> starting_hand);
@@ -0,0 +1,68 @@
+#pragma once
+
+/******************************************************************************
+* Declare a work-stealing thread pool.
+******************************************************************************/
+
+/* Headers
+******************************************************************************/
+// C++ standard library
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>    // For exception_ptr
+#include <functional>   // For std::function
+#include <memory>       // For unique_ptr
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* Declarations
+******************************************************************************/
+class ThreadPool
+{
+    /**
+     * Persistent set of worker threads that run queued tasks.
+     *
+     * Every worker owns a deque of tasks.  Tasks submitted from outside the
+     * pool are dealt round-robin to the deques, and tasks submitted by a
+     * running task go to the deque of the worker running it.  A worker takes
+     * tasks from the back of its own deque and, once that is empty, steals
+     * from the front of the other workers' deques, so no worker sits idle
+     * while any task is waiting.  The task counts are atomic, so the shared
+     * mutex is only taken when a worker has found nothing to run and goes
+     * to sleep, or when the last task finishes.
+    */
+public:
+    // Constructors
+    explicit ThreadPool(unsigned num_threads);
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ~ThreadPool();
+    // Member Functions
+    unsigned size() const;
+    void submit(std::function<void()> task);
+    void wait();
+private:
+    struct WorkQueue
+    {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+    // Data Members
+    std::vector<std::unique_ptr<WorkQueue>> m_queues;
+    std::vector<std::thread> m_workers;
+    std::atomic<size_t> m_next_queue = 0;
+    std::atomic<size_t> m_queued = 0;       // Tasks not yet taken by a worker
+    std::atomic<size_t> m_unfinished = 0;   // Tasks queued or running
+    std::atomic<unsigned> m_sleeping = 0;   // Workers waiting on m_task_cv
+    // Only taken to sleep, wake, stop, or record an error
+    std::mutex m_mutex;
+    std::condition_variable m_task_cv;
+    std::condition_variable m_done_cv;
+    bool m_stop = false;
+    std::exception_ptr m_error;
+    // Member Functions
+    bool m_take_task(unsigned worker_idx, std::function<void()>& task);
+    void m_work(unsigned worker_idx);
+};
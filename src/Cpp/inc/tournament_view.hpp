@@ -0,0 +1,77 @@
+#pragma once
+
+/******************************************************************************
+* Declare a memory-mapped, zero-copy reader for recorded tournament files.
+******************************************************************************/
+
+/* Headers
+******************************************************************************/
+// C++ standard library
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+// Project headers
+#include "serialize.hpp"
+#include "storage.hpp"
+
+/* Declarations
+******************************************************************************/
+class GameView
+{
+    /**
+     * Read-only view of one game's state records inside a mapped tournament
+     * file.
+     *
+     * Iterating visits the GameStateRecords in place; state() decodes one of
+     * them into a GameState.
+    */
+public:
+    // Constructors
+    GameView(const GameRecordHeader* record, const GameStateRecord* states) :
+        m_record(record), m_states(states) {}
+    // Member Functions
+    const GameStateRecord* begin() const { return m_states; }
+    const GameStateRecord* end() const { return m_states + size(); }
+    int game_number() const { return m_record->game_number; }
+    size_t size() const { return static_cast<size_t>(m_record->num_states); }
+    GameState state(size_t idx) const { return decode_game_state(m_states[idx]); }
+    const GameStateRecord& operator[](size_t idx) const { return m_states[idx]; }
+private:
+    // Data Members
+    const GameRecordHeader* m_record;
+    const GameStateRecord* m_states;
+};
+
+class TournamentView
+{
+    /**
+     * Map a versioned tournament file into memory and read it in place.
+     *
+     * The header, games and state records are exposed as views over the
+     * mapped bytes, so nothing is copied or decoded until a state is read and
+     * untouched pages are never loaded from disk.  Views are only valid while the
+     * TournamentView that returned them is open.  Game offsets are taken from
+     * the file's game index, so opening a file does not read any games.
+    */
+public:
+    // Constructors
+    TournamentView() {}
+    TournamentView(const TournamentView&) = delete;
+    TournamentView& operator=(const TournamentView&) = delete;
+    ~TournamentView();
+    // Member Functions
+    void close();
+    GameView game(size_t idx) const;
+    const TournamentFileHeader& header() const;
+    bool is_open() const;
+    size_t num_games() const;
+    bool open(const std::string& filename);
+private:
+    // Data Members
+    const std::byte* m_data = nullptr;
+    size_t m_size = 0;
+    std::vector<size_t> m_game_offsets;
+    // Member Functions
+    void m_index_games();
+};
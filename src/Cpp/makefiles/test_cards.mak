@@ -35,11 +35,11 @@ CPPFLAGS += -std=c++23		# Enable support for ISO C++23 standard
 ## Define source, dependencies (headers), and object files
 ## Then append directory to the filenames
 TEST = $(TESTDIR)/test_cards.cpp
-SRC = $(SRCDIR)/cards.cpp
+SRC = $(SRCDIR)/cards.cpp $(SRCDIR)/evaluator.cpp
 OBJ := $(addprefix $(OBJDIR)/, $(notdir $(SRC)))
 OBJ += $(addprefix $(OBJDIR)/, $(notdir $(TEST)))
 OBJ := $(OBJ:.cpp=.o)
-DEPS = $(INCDIR)/cards.hpp
+DEPS = $(INCDIR)/cards.hpp $(INCDIR)/evaluator.hpp
 
 # Ensure make executes all rules
 all: create_objdir $(BINDIR)/$(BINFILE)
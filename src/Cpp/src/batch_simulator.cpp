@@ -0,0 +1,735 @@
+/******************************************************************************
+* Define a struct-of-arrays simulator that plays many tables in lockstep.
+******************************************************************************/
+
+/* Headers
+******************************************************************************/
+// C++ standard library
+#include <algorithm>    // For std::clamp(), std::min()
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <stdexcept>    // For std::invalid_argument()
+#include <utility>      // For std::to_underlying()
+// Project headers
+#include "batch_simulator.hpp"
+#include "cards.hpp"
+#include "constants.hpp"
+#include "evaluator.hpp"
+#include "random.hpp"
+#include "storage.hpp"
+// Using statements
+using namespace constants;
+
+/* Static Function Definitions
+******************************************************************************/
+static std::uint8_t legal_action_bit(Action action)
+{
+    /**
+     * Return the bit of an action in a legal actions mask.
+     *
+     * Bit i stands for Legal_Actions[i], the same order as the action logits
+     * of the neural network.
+    */
+    for (int i = 0; i < LEGAL_ACTION_COUNT; i++)
+    {
+        if (Legal_Actions[i] == action)
+        {
+            return static_cast<std::uint8_t>(1u << i);
+        }
+    }
+    return 0;
+}
+
+/* BatchSimulator Method Definitions
+******************************************************************************/
+BatchSimulator::BatchSimulator(
+    int num_tables,
+    int num_players,
+    int hands_per_table,
+    int random_seed,
+    unsigned starting_stack,
+    unsigned small_blind,
+    unsigned big_blind) :
+    m_num_tables(num_tables),
+    m_num_players(num_players),
+    m_hands_per_table(hands_per_table),
+    m_random_seed(random_seed),
+    m_starting_stack(starting_stack),
+    m_small_blind(small_blind),
+    m_big_blind(big_blind)
+{
+    if (num_tables < 1 || hands_per_table < 0)
+    {
+        throw std::invalid_argument("Invalid number of tables or hands!");
+    }
+    if (num_players < MIN_PLAYER_COUNT || num_players > MAX_PLAYER_COUNT)
+    {
+        throw std::invalid_argument("Invalid number of players!");
+    }
+    if (small_blind > big_blind || big_blind > starting_stack)
+    {
+        throw std::invalid_argument("Blinds must not exceed the stack!");
+    }
+    const size_t tables = static_cast<size_t>(num_tables);
+    const size_t seats = tables * static_cast<size_t>(num_players);
+    m_round.assign(tables, Round::Game_Result);
+    m_hands_played.assign(tables, 0);
+    m_button.assign(tables, 0);
+    m_to_act.assign(tables, 0);
+    m_current_bet.assign(tables, 0);
+    m_min_raise.assign(tables, 0);
+    m_pot.assign(tables, 0);
+    m_raise_active.assign(tables, 0);
+    m_legal_actions.assign(tables, 0);
+    m_board.assign(tables * MAX_CARDS_IN_HAND, NO_CARD_INDEX);
+    m_board_size.assign(tables, 0);
+    m_decks.resize(tables);
+    m_deck_top.assign(tables, 0);
+    m_deck_rngs.resize(tables);
+    m_stacks.assign(seats, starting_stack);
+    m_bets.assign(seats, 0);
+    m_committed.assign(seats, 0);
+    m_hole_cards.assign(seats * 2, NO_CARD_INDEX);
+    m_folded.assign(seats, 0);
+    m_all_in.assign(seats, 0);
+    m_needs_action.assign(seats, 0);
+    m_can_raise.assign(seats, 0);
+    m_winnings.assign(seats, 0);
+}
+
+std::span<const std::uint8_t> BatchSimulator::board(int table) const
+{
+    /**
+     * Return the card indices of the board dealt so far on a table.
+    */
+    return std::span<const std::uint8_t>(
+        m_board.data() + table * MAX_CARDS_IN_HAND, m_board_size[table]);
+}
+
+unsigned BatchSimulator::chips_bet(int table, int seat) const
+{
+    /**
+     * Return the chips a seat has bet in the current betting round.
+    */
+    return m_bets[m_seat(table, seat)];
+}
+
+unsigned BatchSimulator::chips_to_call(int table) const
+{
+    /**
+     * Return the chips the player to act must push to call.
+     *
+     * A player who cannot cover the bet calls by going all-in.
+    */
+    const int idx = m_seat(table, m_to_act[table]);
+    return std::min(m_current_bet[table] - m_bets[idx], m_stacks[idx]);
+}
+
+GameState BatchSimulator::game_state(int table) const
+{
+    /**
+     * Return the game state seen by the player to act on a table.
+     *
+     * Only the fields read by encode_nn_inputs() and by the player AIs to
+     * choose an action are filled in, so a table can be handed to the same
+     * neural network as the tournament players.  Chips bet in earlier
+     * betting rounds are not tracked per round, so they are all counted in
+     * the pre-flop round.
+     *
+     * @param table is a table waiting for a decision.
+    */
+    const int base = m_seat(table, 0);
+    const int seat = m_to_act[table];
+    GameState gs{};
+    gs.initial_num_players = m_num_players;
+    gs.num_players = m_num_players;
+    gs.player_idx = seat;
+    gs.round = m_round[table];
+    gs.pot_chip_count = m_pot[table];
+    gs.min_bet = m_current_bet[table];
+    gs.sum_prev_bets = m_bets[base + seat];
+    gs.chips_to_call = chips_to_call(table);
+    gs.min_to_raise = m_min_raise[table];
+    gs.max_bet = m_stacks[base + seat];
+    for (int i = 0; i < LEGAL_ACTION_COUNT; i++)
+    {
+        if ((m_legal_actions[table] >> i) & 1)
+        {
+            gs.legal_actions.push_back(Legal_Actions[i]);
+        }
+    }
+    // Board cards
+    std::array<Card*, MAX_CARDS_IN_HAND> board_cards{ &gs.flop_card1,
+        &gs.flop_card2, &gs.flop_card3, &gs.turn_card, &gs.river_card };
+    CardMask board_mask;
+    for (int i = 0; i < m_board_size[table]; i++)
+    {
+        const std::uint8_t card = m_board[table * MAX_CARDS_IN_HAND + i];
+        *board_cards[i] = index_to_card(card);
+        board_mask.add_card_index(card);
+    }
+    // Seat blinds as TexasHoldEm assigns them
+    const int small_blind_seat = (m_num_players == 2) ? m_button[table] :
+        (m_button[table] + 1) % m_num_players;
+    const int big_blind_seat = (small_blind_seat + 1) % m_num_players;
+    gs.blinds.resize(static_cast<size_t>(m_num_players), Blind::No_Blind);
+    if (m_num_players == 2)
+    {
+        gs.blinds[m_button[table]] = Blind::Dealer_Button_and_Small_Blind;
+    }
+    else
+    {
+        gs.blinds[m_button[table]] = Blind::Dealer_Button;
+        gs.blinds[small_blind_seat] = Blind::Small_Blind;
+        for (int i = 1; i < m_num_players - 2; i++)
+        {
+            gs.blinds[(big_blind_seat + i) % m_num_players] =
+                UTG_Players[i - 1];
+        }
+    }
+    gs.blinds[big_blind_seat] = Blind::Big_Blind;
+    // Seat cards and chips
+    const int round_idx = std::to_underlying(m_round[table]);
+    for (int s = 0; s < m_num_players; s++)
+    {
+        const std::uint8_t card1 = m_hole_cards[2 * (base + s)];
+        const std::uint8_t card2 = m_hole_cards[2 * (base + s) + 1];
+        gs.hole_cards.push_back(
+            std::make_pair(index_to_card(card1), index_to_card(card2)));
+        CardMask mask = board_mask;
+        mask.add_card_index(card1);
+        mask.add_card_index(card2);
+        gs.hand_ranks.push_back(evaluate_hand(mask).hand_rank);
+        gs.player_chip_counts.push_back(m_stacks[base + s]);
+        gs.pot_player_bets[s][0] = m_committed[base + s] - m_bets[base + s];
+        gs.pot_player_bets[s][round_idx] += m_bets[base + s];
+        gs.num_active_players += !m_folded[base + s];
+    }
+    return gs;
+}
+
+std::span<const std::uint8_t> BatchSimulator::hole_cards(
+    int table, int seat) const
+{
+    /**
+     * Return the two card indices dealt to a seat.
+    */
+    return std::span<const std::uint8_t>(
+        m_hole_cards.data() + 2 * m_seat(table, seat), 2);
+}
+
+bool BatchSimulator::is_finished() const
+{
+    for (int t = 0; t < m_num_tables; t++)
+    {
+        if (m_hands_played[t] < m_hands_per_table) { return false; }
+    }
+    return true;
+}
+
+bool BatchSimulator::is_folded(int table, int seat) const
+{
+    return m_folded[m_seat(table, seat)] != 0;
+}
+
+std::uint8_t BatchSimulator::legal_actions(int table) const
+{
+    /**
+     * Return the legal actions of the player to act as a bitmask.
+     *
+     * Bit i is set if Legal_Actions[i] is legal.  The mask is zero while the
+     * table is between hands.
+    */
+    return m_legal_actions[table];
+}
+
+unsigned BatchSimulator::min_raise(int table) const
+{
+    /**
+     * Return the minimum number of chips to raise by, on top of the call.
+    */
+    return m_min_raise[table];
+}
+
+std::uint64_t BatchSimulator::num_decisions() const
+{
+    return m_num_decisions;
+}
+
+std::uint64_t BatchSimulator::num_hands() const
+{
+    return m_num_hands;
+}
+
+int BatchSimulator::num_players() const
+{
+    return m_num_players;
+}
+
+int BatchSimulator::num_tables() const
+{
+    return m_num_tables;
+}
+
+int BatchSimulator::player_to_act(int table) const
+{
+    return m_to_act[table];
+}
+
+unsigned BatchSimulator::pot(int table) const
+{
+    return m_pot[table];
+}
+
+Round BatchSimulator::round(int table) const
+{
+    return m_round[table];
+}
+
+std::uint64_t BatchSimulator::run(const BatchPolicy& policy)
+{
+    /**
+     * Step every table until each has played all of its hands.
+     *
+     * @param policy chooses the actions of each step.
+     * @return The number of decisions made.
+    */
+    const std::uint64_t start = m_num_decisions;
+    while (step(policy) > 0) {}
+    return m_num_decisions - start;
+}
+
+unsigned BatchSimulator::stack(int table, int seat) const
+{
+    return m_stacks[m_seat(table, seat)];
+}
+
+size_t BatchSimulator::step(const BatchPolicy& policy)
+{
+    /**
+     * Make one decision on every table that is still playing.
+     *
+     * Tables between hands deal their next hand first.  The policy is called
+     * once with every table that is waiting for a decision, and each table
+     * then runs until its next decision, dealing streets and settling the
+     * pot as needed.
+     *
+     * @param policy chooses the actions of the players to act.
+     * @return The number of decisions made, or 0 once every table finished.
+    */
+    m_pending.clear();
+    for (int t = 0; t < m_num_tables; t++)
+    {
+        while (m_round[t] == Round::Game_Result &&
+            m_hands_played[t] < m_hands_per_table)
+        {
+            m_start_hand(t);
+        }
+        if (m_round[t] != Round::Game_Result)
+        {
+            m_pending.push_back(t);
+        }
+    }
+    if (m_pending.empty()) { return 0; }
+    m_actions.assign(m_pending.size(), BatchAction());
+    policy(*this, m_pending, m_actions);
+    for (size_t i = 0; i < m_pending.size(); i++)
+    {
+        m_apply_action(m_pending[i], m_actions[i]);
+    }
+    m_num_decisions += m_pending.size();
+    return m_pending.size();
+}
+
+std::int64_t BatchSimulator::winnings(int table, int seat) const
+{
+    /**
+     * Return the chips a seat has won, or lost if negative, over all hands.
+    */
+    return m_winnings[m_seat(table, seat)];
+}
+
+/* Private BatchSimulator Method Definitions
+******************************************************************************/
+void BatchSimulator::m_advance(int table, int seat)
+{
+    /**
+     * Run a table until its next decision or the end of the hand.
+     *
+     * @param table is the table index.
+     * @param seat is the first seat that may act next.
+    */
+    const int base = m_seat(table, 0);
+    while (true)
+    {
+        int num_in_hand = 0;
+        int last_seat = 0;
+        for (int s = 0; s < m_num_players; s++)
+        {
+            if (!m_folded[base + s])
+            {
+                num_in_hand++;
+                last_seat = s;
+            }
+        }
+        if (num_in_hand == 1)
+        {
+            // Everyone else folded, so any uncalled bet is returned too
+            m_stacks[base + last_seat] += m_pot[table];
+            m_pot[table] = 0;
+            m_finish_hand(table);
+            return;
+        }
+        for (int i = 0; i < m_num_players; i++)
+        {
+            const int s = (seat + i) % m_num_players;
+            if (m_needs_action[base + s] && !m_folded[base + s] &&
+                !m_all_in[base + s])
+            {
+                m_to_act[table] = s;
+                m_determine_legal_actions(table);
+                return;
+            }
+        }
+        // Betting round is over
+        if (m_round[table] == Round::River)
+        {
+            m_showdown(table);
+            return;
+        }
+        m_start_round(table);
+        seat = (m_button[table] + 1) % m_num_players;
+    }
+}
+
+void BatchSimulator::m_apply_action(int table, const BatchAction& action)
+{
+    /**
+     * Apply the action of the player to act and advance the table.
+     *
+     * Bet, Raise and Re_Raise push action.chips, clamped between a minimum
+     * raise and the player's stack.
+    */
+    const int seat = m_to_act[table];
+    const int idx = m_seat(table, seat);
+    const unsigned to_call = m_current_bet[table] - m_bets[idx];
+    assert((m_legal_actions[table] & legal_action_bit(action.action)) &&
+        "Illegal batch action!");
+    switch (action.action)
+    {
+    case Action::Fold:
+        m_folded[idx] = 1;
+        break;
+    case Action::Check:
+        break;
+    case Action::Call:
+        m_push_chips(table, seat, std::min(to_call, m_stacks[idx]));
+        break;
+    case Action::All_In:
+        m_push_chips(table, seat, m_stacks[idx]);
+        break;
+    case Action::Bet:
+    case Action::Raise:
+    case Action::Re_Raise:
+        m_push_chips(table, seat, std::clamp(action.chips,
+            to_call + m_min_raise[table], m_stacks[idx]));
+        break;
+    default:
+        assert(false && "Invalid batch action!");
+    }
+    if (m_bets[idx] > m_current_bet[table])
+    {
+        // Every other player must respond to the raise, but only a full
+        // raise re-opens raising to players who have already acted
+        const unsigned raise = m_bets[idx] - m_current_bet[table];
+        const bool full_raise = raise >= m_min_raise[table];
+        m_current_bet[table] = m_bets[idx];
+        if (full_raise)
+        {
+            m_min_raise[table] = raise;
+            if (action.action != Action::Bet)
+            {
+                m_raise_active[table] = 1;
+            }
+        }
+        const int base = m_seat(table, 0);
+        for (int s = 0; s < m_num_players; s++)
+        {
+            if (!m_folded[base + s] && !m_all_in[base + s])
+            {
+                m_needs_action[base + s] = 1;
+                if (full_raise) { m_can_raise[base + s] = 1; }
+            }
+        }
+    }
+    m_needs_action[idx] = 0;
+    m_can_raise[idx] = 0;
+    m_advance(table, (seat + 1) % m_num_players);
+}
+
+std::uint8_t BatchSimulator::m_deal_card(int table)
+{
+    /**
+     * Draw the next card of a table from the rest of its deck.
+    */
+    PackedDeck& deck = m_decks[table];
+    const int top = m_deck_top[table]++;
+    partial_shuffle(deck.data() + top, NUMBER_CARDS_IN_DECK - top, 1,
+        m_deck_rngs[table]);
+    return deck[top];
+}
+
+void BatchSimulator::m_determine_legal_actions(int table)
+{
+    /**
+     * Determine the legal actions of the player to act.
+     *
+     * Follows the rules of TexasHoldEm::m_determine_legal_actions().
+    */
+    const int idx = m_seat(table, m_to_act[table]);
+    const unsigned to_call = m_current_bet[table] - m_bets[idx];
+    const unsigned chips = m_stacks[idx];
+    std::uint8_t legal = 0;
+    if (to_call >= chips)
+    {
+        legal |= legal_action_bit(Action::All_In);
+        legal |= legal_action_bit(Action::Fold);
+    }
+    else
+    {
+        legal |= legal_action_bit(Action::Fold);
+        if (m_can_raise[idx])
+        {
+            legal |= legal_action_bit(Action::All_In);
+        }
+        legal |= legal_action_bit(to_call == 0 ? Action::Check : Action::Call);
+        if (m_can_raise[idx] && chips > to_call + m_min_raise[table])
+        {
+            if (m_raise_active[table])
+            {
+                legal |= legal_action_bit(Action::Re_Raise);
+            }
+            else if (to_call == 0 && m_round[table] != Round::Pre_Flop)
+            {
+                // Post-flop first bet
+                legal |= legal_action_bit(Action::Bet);
+            }
+            else
+            {
+                // Pre-flop big blind is first bet, so player raises
+                legal |= legal_action_bit(Action::Raise);
+            }
+        }
+    }
+    m_legal_actions[table] = legal;
+}
+
+void BatchSimulator::m_finish_hand(int table)
+{
+    const int base = m_seat(table, 0);
+    for (int s = 0; s < m_num_players; s++)
+    {
+        m_winnings[base + s] += static_cast<std::int64_t>(m_stacks[base + s]) -
+            static_cast<std::int64_t>(m_starting_stack);
+    }
+    m_round[table] = Round::Game_Result;
+    m_legal_actions[table] = 0;
+    m_hands_played[table]++;
+    m_num_hands++;
+}
+
+void BatchSimulator::m_push_chips(int table, int seat, unsigned chips)
+{
+    const int idx = m_seat(table, seat);
+    assert((chips <= m_stacks[idx]) && "Not enough chips!");
+    m_stacks[idx] -= chips;
+    m_bets[idx] += chips;
+    m_committed[idx] += chips;
+    m_pot[table] += chips;
+    if (m_stacks[idx] == 0)
+    {
+        m_all_in[idx] = 1;
+    }
+}
+
+void BatchSimulator::m_showdown(int table)
+{
+    /**
+     * Evaluate every hand and award the main pot and side pots.
+     *
+     * Each pot is a layer of the chips committed this hand, up to the
+     * smallest commitment of the players still in the hand.  Split pots give
+     * the odd chips to the winners closest to the left of the button.
+    */
+    const int base = m_seat(table, 0);
+    CardMask board_mask;
+    for (int i = 0; i < m_board_size[table]; i++)
+    {
+        board_mask.add_card_index(m_board[table * MAX_CARDS_IN_HAND + i]);
+    }
+    std::array<CardMask, MAX_PLAYER_COUNT> hole_masks;
+    std::array<std::uint32_t, MAX_PLAYER_COUNT> keys{};
+    std::array<unsigned, MAX_PLAYER_COUNT> remaining{};
+    for (int s = 0; s < m_num_players; s++)
+    {
+        hole_masks[s].add_card_index(m_hole_cards[2 * (base + s)]);
+        hole_masks[s].add_card_index(m_hole_cards[2 * (base + s) + 1]);
+        remaining[s] = m_committed[base + s];
+    }
+    evaluate_hands(board_mask, hole_masks.data(),
+        static_cast<size_t>(m_num_players), keys.data());
+    while (true)
+    {
+        unsigned level = 0;
+        for (int s = 0; s < m_num_players; s++)
+        {
+            if (!m_folded[base + s] && remaining[s] > 0 &&
+                (level == 0 || remaining[s] < level))
+            {
+                level = remaining[s];
+            }
+        }
+        if (level == 0) { break; }
+        // Players still in the hand with chips left all contest this pot
+        std::array<bool, MAX_PLAYER_COUNT> contests{};
+        unsigned pot = 0;
+        std::uint32_t best_key = 0;
+        int num_winners = 0;
+        for (int s = 0; s < m_num_players; s++)
+        {
+            contests[s] = !m_folded[base + s] && remaining[s] > 0;
+            if (contests[s])
+            {
+                if (keys[s] > best_key)
+                {
+                    best_key = keys[s];
+                    num_winners = 0;
+                }
+                if (keys[s] == best_key) { num_winners++; }
+            }
+        }
+        for (int s = 0; s < m_num_players; s++)
+        {
+            const unsigned chips = std::min(remaining[s], level);
+            pot += chips;
+            remaining[s] -= chips;
+        }
+        const unsigned share = pot / static_cast<unsigned>(num_winners);
+        unsigned odd_chips = pot % static_cast<unsigned>(num_winners);
+        for (int i = 1; i <= m_num_players; i++)
+        {
+            const int s = (m_button[table] + i) % m_num_players;
+            if (contests[s] && keys[s] == best_key)
+            {
+                m_stacks[base + s] += share;
+                if (odd_chips > 0)
+                {
+                    m_stacks[base + s]++;
+                    odd_chips--;
+                }
+            }
+        }
+    }
+    // Return chips that no player still in the hand matched
+    for (int s = 0; s < m_num_players; s++)
+    {
+        m_stacks[base + s] += remaining[s];
+    }
+    m_pot[table] = 0;
+    m_finish_hand(table);
+}
+
+void BatchSimulator::m_start_hand(int table)
+{
+    /**
+     * Reset the stacks, deal the hole cards and post the blinds.
+    */
+    const int hand = m_hands_played[table];
+    const int base = m_seat(table, 0);
+    for (int s = 0; s < m_num_players; s++)
+    {
+        m_stacks[base + s] = m_starting_stack;
+        m_bets[base + s] = 0;
+        m_committed[base + s] = 0;
+        m_folded[base + s] = 0;
+        m_all_in[base + s] = 0;
+    }
+    m_button[table] = hand % m_num_players;
+    m_pot[table] = 0;
+    m_board_size[table] = 0;
+    // Lazy dealing only draws the cards that are used
+    PackedDeck& deck = m_decks[table];
+    for (int i = 0; i < NUMBER_CARDS_IN_DECK; i++)
+    {
+        deck[i] = static_cast<std::uint8_t>(i);
+    }
+    m_deck_top[table] = 0;
+    m_deck_rngs[table] = StreamRng(
+        static_cast<std::uint64_t>(m_random_seed), RngStream::Deck,
+        static_cast<std::uint64_t>(table), static_cast<std::uint64_t>(hand),
+        0);
+    for (int s = 0; s < m_num_players; s++)
+    {
+        m_hole_cards[2 * (base + s)] = m_deal_card(table);
+        m_hole_cards[2 * (base + s) + 1] = m_deal_card(table);
+    }
+    // Heads-up the button posts the small blind
+    const int small_blind_seat = (m_num_players == 2) ? m_button[table] :
+        (m_button[table] + 1) % m_num_players;
+    const int big_blind_seat = (small_blind_seat + 1) % m_num_players;
+    m_push_chips(table, small_blind_seat, m_small_blind);
+    m_push_chips(table, big_blind_seat, m_big_blind);
+    m_round[table] = Round::Pre_Flop;
+    m_current_bet[table] = m_big_blind;
+    m_min_raise[table] = m_big_blind;
+    m_raise_active[table] = 0;
+    for (int s = 0; s < m_num_players; s++)
+    {
+        m_needs_action[base + s] = !m_all_in[base + s];
+        m_can_raise[base + s] = 1;
+    }
+    m_advance(table, (big_blind_seat + 1) % m_num_players);
+}
+
+void BatchSimulator::m_start_round(int table)
+{
+    /**
+     * Deal the next street and reset the bets of the new betting round.
+     *
+     * The round has no betting if fewer than two players can still act.
+    */
+    const int base = m_seat(table, 0);
+    int num_can_act = 0;
+    for (int s = 0; s < m_num_players; s++)
+    {
+        const bool can_act = !m_folded[base + s] && !m_all_in[base + s];
+        m_bets[base + s] = 0;
+        m_needs_action[base + s] = can_act;
+        m_can_raise[base + s] = 1;
+        num_can_act += can_act;
+    }
+    if (num_can_act < 2)
+    {
+        for (int s = 0; s < m_num_players; s++)
+        {
+            m_needs_action[base + s] = 0;
+        }
+    }
+    m_current_bet[table] = 0;
+    m_min_raise[table] = m_big_blind;
+    m_raise_active[table] = 0;
+    const int num_cards = (m_round[table] == Round::Pre_Flop) ? 3 : 1;
+    for (int i = 0; i < num_cards; i++)
+    {
+        m_board[table * MAX_CARDS_IN_HAND + m_board_size[table]++] =
+            m_deal_card(table);
+    }
+    m_round[table] = static_cast<Round>(std::to_underlying(m_round[table]) + 1);
+}
+
+int BatchSimulator::m_seat(int table, int seat) const
+{
+    return table * m_num_players + seat;
+}
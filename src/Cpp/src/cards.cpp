@@ -10,11 +10,13 @@
 #include <iostream>
 #include <random> // For shuffle()
 #include <ranges> // For views::drop()
+#include <stdexcept> // For invalid_argument()
 #include <string>
 #include <utility> // For to_underlying()
 // Project headers
 #include "cards.hpp"
 #include "constants.hpp"
+#include "evaluator.hpp"
 // Using statements
 using std::cout;
 using std::endl;
@@ -79,17 +81,92 @@ std::ostream& operator<<(std::ostream& os, const Card& c)
     return os;
 }
 
+/* Card Index Function Definitions
+******************************************************************************/
+int card_index(const Card& c)
+{
+    /**
+     * Return the compact index of a card, or NO_CARD_INDEX for a blank card.
+     *
+     * Cards are numbered 0-51 in the order of Card_Suits, then Card_Ranks,
+     * so every card fits in six bits.
+    */
+    int suit_idx = suit_index(c.suit);
+    if (c.rank == Rank::No_Card || suit_idx < 0) { return NO_CARD_INDEX; }
+    return suit_idx * NUMBER_CARDS_IN_SUIT +
+        (to_underlying(c.rank) - to_underlying(Rank::Two));
+}
+
+Card index_to_card(int idx)
+{
+    if (idx < 0 || idx >= NUMBER_CARDS_IN_DECK) { return Card(); }
+    return Card(Card_Suits[idx / NUMBER_CARDS_IN_SUIT],
+        Card_Ranks[idx % NUMBER_CARDS_IN_SUIT]);
+}
+
+/* CardMask Method Definitions
+******************************************************************************/
+void CardMask::add_card(const Card& c)
+{
+    /**
+     * Add a card to the mask.  Blank cards are ignored.
+    */
+    if (c.rank == Rank::No_Card) { return; }
+    int suit_idx = suit_index(c.suit);
+    if (suit_idx < 0)
+    {
+        throw std::invalid_argument("Received invalid No_Card suit.");
+    }
+    suit_ranks[suit_idx] |= static_cast<uint16_t>(
+        1u << (to_underlying(c.rank) - 2));
+}
+
+void CardMask::clear()
+{
+    suit_ranks.fill(0);
+}
+
+bool CardMask::contains(const Card& c) const
+{
+    int suit_idx = suit_index(c.suit);
+    if (c.rank == Rank::No_Card || suit_idx < 0) { return false; }
+    return suit_ranks[suit_idx] & (1u << (to_underlying(c.rank) - 2));
+}
+
+uint16_t CardMask::rank_mask() const
+{
+    return suit_ranks[0] | suit_ranks[1] | suit_ranks[2] | suit_ranks[3];
+}
+
+/* Board Method Definitions
+******************************************************************************/
+void Board::add_card(const Card& c)
+{
+    /**
+     * Add the next community card to the board.
+    */
+    assert((m_num_cards < MAX_CARDS_IN_HAND) &&
+        "Board cannot have more than five cards!");
+    m_cards[m_num_cards] = c;
+    m_masks[m_num_cards + 1] = m_masks[m_num_cards];
+    m_masks[m_num_cards + 1].add_card(c);
+    m_num_cards++;
+}
+
+void Board::clear()
+{
+    m_cards.fill(Card());
+    m_masks.fill(CardMask());
+    m_num_cards = 0;
+}
+
 /* Deck Method Definitions
 ******************************************************************************/
 void Deck::m_build_deck()
 {
-    size_t size = 0;
-    for (const auto& i : Card_Suits)
+    for (int i = 0; i < NUMBER_CARDS_IN_DECK; i++)
     {
-        for (const auto& j : Card_Ranks)
-        {
-            m_cards[size++] = Card(i, j);
-        }
+        m_cards[i] = static_cast<std::uint8_t>(i);
     }
     assert((m_cards.size() == NUMBER_CARDS_IN_DECK) &&
         "Invalid  number of cards in deck!");
@@ -97,19 +174,32 @@ void Deck::m_build_deck()
 
 void Deck::burn_one_card()
 {
+    /**
+     * Burn the top card of the deck.
+     *
+     * A burned card is never seen, so a lazy deal skips it without drawing a
+     * random number.  Every card dealt is still uniformly random.
+    */
+    if (m_lazy_deal) { return; }
     m_top_card_idx++;
 }
 
 Card Deck::deal_one_card()
 {
-    return m_cards[m_top_card_idx++];
+    if (m_lazy_deal)
+    {
+        // Swap a random card from the rest of the deck into place
+        partial_shuffle(m_cards.data() + m_top_card_idx,
+            NUMBER_CARDS_IN_DECK - m_top_card_idx, 1, rng);
+    }
+    return index_to_card(m_cards[m_top_card_idx++]);
 }
 
 void Deck::print_cards()
 {
     for (const auto& card : m_cards)
     {
-        std::cout << card << std::endl;
+        std::cout << index_to_card(card) << std::endl;
     }
 }
 
@@ -117,6 +207,43 @@ void Deck::shuffle_deck()
 {
     std::shuffle(m_cards.begin(), m_cards.end(), rng);
     m_top_card_idx = 0;
+    m_lazy_deal = false;
+}
+
+void Deck::shuffle_deck(int num_cards)
+{
+    /**
+     * Shuffle only the num_cards cards that will be dealt from the top.
+     *
+     * The dealt cards are as random as with a full shuffle, but only
+     * num_cards random numbers are drawn.
+    */
+    assert((num_cards >= 0 && num_cards <= NUMBER_CARDS_IN_DECK) &&
+        "Cannot deal more cards than the deck holds!");
+    partial_shuffle(m_cards.data(), NUMBER_CARDS_IN_DECK, num_cards, rng);
+    m_top_card_idx = 0;
+    m_lazy_deal = false;
+}
+
+void Deck::shuffle_deck(DealMode mode)
+{
+    /**
+     * Prepare the deck for a new deal in the given mode.
+     *
+     * A full shuffle permutes all 52 cards up front, continuing from the
+     * order left by the previous deal.  A lazy deal instead starts from a
+     * fresh deck and draws each card when it is dealt, so the random numbers
+     * drawn are proportional to the cards dealt and the deal depends only on
+     * the deck's random number stream.
+    */
+    if (mode == DealMode::Lazy)
+    {
+        m_build_deck();
+        m_top_card_idx = 0;
+        m_lazy_deal = true;
+        return;
+    }
+    shuffle_deck();
 }
 
 void Deck::stack_the_deck(vector<Card> cards)
@@ -128,9 +255,10 @@ void Deck::stack_the_deck(vector<Card> cards)
     */
     for (size_t i = 0; i < cards.size(); i++)
     {
-        m_cards[i] = cards[i];
+        m_cards[i] = static_cast<std::uint8_t>(card_index(cards[i]));
     }
     m_top_card_idx = 0;
+    m_lazy_deal = false;
 }
 
 /* Hand Method Definitions
@@ -156,14 +284,9 @@ void Hand::clear_hand()
     hole_card1 = Card();
     hole_card2 = Card();
     available_cards.clear();
-    d.clear();
-    h.clear();
-    c.clear();
-    s.clear();
-    flush_hand.clear();
-    straight_hand.clear();
     best_hand.fill(Card(Suit::No_Card, Rank::No_Card));
     hand_rank = HandRank::High_Card;
+    hand_strength = 0;
 }
 
 void Hand::determine_best_hand()
@@ -172,6 +295,14 @@ void Hand::determine_best_hand()
      * Determines best five card poker hand from available cards.
     */
     m_sort_cards();
+    if constexpr (USE_LOOKUP_EVALUATOR)
+    {
+        HandStrength strength = evaluate_hand(available_cards);
+        hand_rank = strength.hand_rank;
+        hand_strength = strength.key;
+        best_hand = select_best_hand(available_cards, strength);
+        return;
+    }
     if (available_cards.size() <= 2)
     {
         best_hand = { available_cards[0],
@@ -189,10 +320,12 @@ void Hand::determine_best_hand()
         }
         return;
     }
-    if (m_is_flush())
+    // Cards of the best hand found by each test
+    vector<Card> flush_hand, straight_hand, high_hand;
+    if (m_is_flush(flush_hand))
     {
         hand_rank = HandRank::Flush;
-        if (m_is_straight_flush(flush_hand))
+        if (m_is_straight_flush(flush_hand, straight_hand))
         {
             hand_rank = HandRank::Straight_Flush;
             if (straight_hand[straight_hand.size() - 1].rank == Rank::Ace)
@@ -204,7 +337,7 @@ void Hand::determine_best_hand()
                 best_hand[i] = straight_hand[i];
             }
         }
-        else if (m_is_wheel_straight_flush(flush_hand))
+        else if (m_is_wheel_straight_flush(flush_hand, straight_hand))
         {
             hand_rank = HandRank::Wheel_Straight_Flush;
             for (size_t i = 0; i < MAX_CARDS_IN_HAND; i++)
@@ -221,7 +354,7 @@ void Hand::determine_best_hand()
             }
         }
     }
-    else if (m_is_four_of_a_kind())
+    else if (m_is_four_of_a_kind(high_hand))
     {
         hand_rank = HandRank::Four_of_a_Kind;
         for (size_t i = 0; i < MAX_CARDS_IN_HAND; i++)
@@ -229,7 +362,7 @@ void Hand::determine_best_hand()
             best_hand[i] = high_hand[i];
         }
     }
-    else if (m_is_full_house())
+    else if (m_is_full_house(high_hand))
     {
         hand_rank = HandRank::Full_House;
         for (size_t i = 0; i < MAX_CARDS_IN_HAND; i++)
@@ -241,7 +374,7 @@ void Hand::determine_best_hand()
     {
         return;
     }
-    else if (m_is_straight())
+    else if (m_is_straight(straight_hand))
     {
         hand_rank = HandRank::Straight;
         for (size_t i = 0; i < MAX_CARDS_IN_HAND; i++)
@@ -249,7 +382,7 @@ void Hand::determine_best_hand()
             best_hand[i] = straight_hand[i];
         }
     }
-    else if (m_is_wheel_straight())
+    else if (m_is_wheel_straight(straight_hand))
     {
         hand_rank = HandRank::Wheel_Straight;
         for (size_t i = 0; i < MAX_CARDS_IN_HAND; i++)
@@ -257,7 +390,7 @@ void Hand::determine_best_hand()
             best_hand[i] = straight_hand[i];
         }
     }
-    else if (m_is_three_of_a_kind())
+    else if (m_is_three_of_a_kind(high_hand))
     {
         hand_rank = HandRank::Three_of_a_Kind;
         for (size_t i = 0; i < MAX_CARDS_IN_HAND; i++)
@@ -265,7 +398,7 @@ void Hand::determine_best_hand()
             best_hand[i] = high_hand[i];
         }
     }
-    else if (m_is_two_pair())
+    else if (m_is_two_pair(high_hand))
     {
         hand_rank = HandRank::Two_Pair;
         for (size_t i = 0; i < MAX_CARDS_IN_HAND; i++)
@@ -273,7 +406,7 @@ void Hand::determine_best_hand()
             best_hand[i] = high_hand[i];
         }
     }
-    else if (m_is_one_pair())
+    else if (m_is_one_pair(high_hand))
     {
         hand_rank = HandRank::Pair;
         for (size_t i = 0; i < MAX_CARDS_IN_HAND; i++)
@@ -390,7 +523,7 @@ void Hand::m_sort_cards()
         Hand::card_sorter);
 }
 
-bool Hand::m_is_one_pair()
+bool Hand::m_is_one_pair(std::vector<Card>& high_hand) const
 {
     high_hand.clear();
     vector<Card> remaining_cards;
@@ -428,7 +561,7 @@ bool Hand::m_is_one_pair()
     return true;
 }
 
-bool Hand::m_is_two_pair()
+bool Hand::m_is_two_pair(std::vector<Card>& high_hand) const
 {
     high_hand.clear();
     vector<Rank> pairs;
@@ -471,7 +604,7 @@ bool Hand::m_is_two_pair()
     return true;
 }
 
-bool Hand::m_is_three_of_a_kind()
+bool Hand::m_is_three_of_a_kind(std::vector<Card>& high_hand) const
 {
     high_hand.clear();
     bool three = false;
@@ -517,12 +650,13 @@ bool Hand::m_is_three_of_a_kind()
     return true;
 }
 
-bool Hand::m_is_straight()
+bool Hand::m_is_straight(std::vector<Card>& straight_hand) const
 {
-    return m_is_straight(available_cards);
+    return m_is_straight(available_cards, straight_hand);
 }
 
-bool Hand::m_is_straight(std::vector<Card> hand)
+bool Hand::m_is_straight(
+    std::vector<Card> hand, std::vector<Card>& straight_hand) const
 {
     straight_hand.clear();
     std::sort(hand.begin(), hand.end(), Hand::card_sorter);
@@ -566,17 +700,19 @@ bool Hand::m_is_straight(std::vector<Card> hand)
     return false;
 }
 
-bool Hand::m_is_wheel_straight_flush(std::vector<Card> hand)
+bool Hand::m_is_wheel_straight_flush(
+    std::vector<Card> hand, std::vector<Card>& straight_hand) const
 {
-    return m_is_wheel_straight(hand);
+    return m_is_wheel_straight(hand, straight_hand);
 }
 
-bool Hand::m_is_wheel_straight()
+bool Hand::m_is_wheel_straight(std::vector<Card>& straight_hand) const
 {
-    return m_is_wheel_straight(available_cards);
+    return m_is_wheel_straight(available_cards, straight_hand);
 }
 
-bool Hand::m_is_wheel_straight(std::vector<Card> hand)
+bool Hand::m_is_wheel_straight(
+    std::vector<Card> hand, std::vector<Card>& straight_hand) const
 {
     // Check for "wheel" straight where Ace takes value of 1
     straight_hand.clear();
@@ -619,12 +755,9 @@ bool Hand::m_is_wheel_straight(std::vector<Card> hand)
     return false;
 }
 
-bool Hand::m_is_flush()
+bool Hand::m_is_flush(std::vector<Card>& flush_hand) const
 {
-    d.clear();
-    h.clear();
-    c.clear();
-    s.clear();
+    vector<Card> d, h, c, s;
     flush_hand.clear();
     for (const auto& i : available_cards)
     {
@@ -678,7 +811,7 @@ bool Hand::m_is_flush()
     return true;
 }
 
-bool Hand::m_is_full_house()
+bool Hand::m_is_full_house(std::vector<Card>& high_hand) const
 {
     high_hand.clear();
     bool three = false;
@@ -747,7 +880,7 @@ bool Hand::m_is_full_house()
     return true;
 }
 
-bool Hand::m_is_four_of_a_kind()
+bool Hand::m_is_four_of_a_kind(std::vector<Card>& high_hand) const
 {
     high_hand.clear();
     std::map<Rank, int> count;
@@ -781,7 +914,8 @@ bool Hand::m_is_four_of_a_kind()
     return false;
 }
 
-bool Hand::m_is_straight_flush(std::vector<Card> hand)
+bool Hand::m_is_straight_flush(
+    std::vector<Card> hand, std::vector<Card>& straight_hand) const
 {
-    return m_is_straight(hand);
+    return m_is_straight(hand, straight_hand);
 }
\ No newline at end of file
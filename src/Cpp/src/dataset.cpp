@@ -0,0 +1,223 @@
+/******************************************************************************
+* Define the exporter that converts tournament files into a training dataset.
+*
+* Every recorded game state becomes one float32 row of NN_VECTOR_SIZE values,
+* encoded with encode_nn_inputs() and encode_nn_labels().  Rows are written in
+* the order of the file list and, within a file, in the order they were
+* recorded, so the output does not depend on the number of threads.
+******************************************************************************/
+
+/* Headers
+******************************************************************************/
+// C++ standard library
+#include <algorithm>    // For std::max(), std::sort()
+#include <cstring>      // For std::memcpy()
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>    // For std::runtime_error
+#include <string>
+#include <vector>
+// Project headers
+#include "constants.hpp"
+#include "dataset.hpp"
+#include "serialize.hpp"
+#include "storage.hpp"
+#include "thread_pool.hpp"
+#include "tournament_view.hpp"
+// Using statements
+using std::string;
+using std::vector;
+using namespace constants;
+
+/* Constants and Enums
+******************************************************************************/
+const char DATASET_FILE_MAGIC[4] = { 'D', 'S', 'N', 'N' };
+
+/* Helper Function Definitions
+******************************************************************************/
+template<typename F>
+static void for_each_recorded_state(const string& filename, F&& fn)
+{
+    /**
+     * Call fn on every state of a tournament file in the order recorded.
+     *
+     * Versioned files are mapped and each state record is decoded as it is
+     * visited; older files are deserialized first.
+     *
+     * @throws std::runtime_error if the file can't be read.
+    */
+    TournamentView view;
+    if (view.open(filename))
+    {
+        for (size_t i = 0; i < view.num_games(); i++)
+        {
+            for (const auto& record : view.game(i))
+            {
+                fn(decode_game_state(record));
+            }
+        }
+        return;
+    }
+    TournamentHistory th = read_tournamenthistory(filename);
+    for (const auto& gh : th.games)
+    {
+        for (const auto& gs : gh.states)
+        {
+            fn(gs);
+        }
+    }
+}
+
+/* Dataset Function Definitions
+******************************************************************************/
+vector<string> list_tournament_files(const string& directory)
+{
+    /**
+     * Return every recorded tournament file below a directory.
+     *
+     * Only files named like those written by TexasHoldEm (tourn_*.bin) are
+     * returned, so tables and models stored alongside them are skipped.
+     *
+     * @param directory is searched recursively.
+     * @return The file paths in sorted order.
+    */
+    vector<string> filenames;
+    for (const auto& entry :
+        std::filesystem::recursive_directory_iterator(directory))
+    {
+        const string name = entry.path().filename().string();
+        if (entry.is_regular_file() && name.starts_with("tourn_") &&
+            entry.path().extension() == ".bin")
+        {
+            filenames.push_back(entry.path().string());
+        }
+    }
+    std::sort(filenames.begin(), filenames.end());
+    return filenames;
+}
+
+size_t count_nn_rows(const string& filename)
+{
+    /**
+     * Return the number of recorded states in a tournament file.
+     *
+     * Versioned files are counted from their game records without reading
+     * any states.
+    */
+    TournamentView view;
+    if (view.open(filename))
+    {
+        size_t num_rows = 0;
+        for (size_t i = 0; i < view.num_games(); i++)
+        {
+            num_rows += view.game(i).size();
+        }
+        return num_rows;
+    }
+    size_t num_rows = 0;
+    for_each_recorded_state(filename, [&num_rows](const GameState&)
+        { num_rows++; });
+    return num_rows;
+}
+
+size_t export_nn_dataset(
+    const vector<string>& filenames,
+    const string& write_filename,
+    unsigned num_threads)
+{
+    /**
+     * Convert many tournament files into one neural network dataset file.
+     *
+     * The rows of every file are counted first so that each file's position
+     * in the output is known.  Each file is then a task on a thread pool
+     * that encodes the whole file into a buffer and writes it straight to
+     * its position, so no thread waits on another.
+     *
+     * @param filenames are the tournament files to convert.
+     * @param write_filename is overwritten with a DatasetFileHeader followed
+     *        by the rows of every file.
+     * @param num_threads is the number of threads to convert with.
+     * @return The number of rows written.
+     * @throws std::runtime_error if a file cannot be read or written.
+    */
+    const size_t num_files = filenames.size();
+    const size_t row_size = sizeof(float) * NN_VECTOR_SIZE;
+    ThreadPool pool(std::max(num_threads, 1u));
+    // Count rows and assign each file its first row
+    vector<size_t> file_rows(num_files, 0);
+    for (size_t idx = 0; idx < num_files; idx++)
+    {
+        pool.submit([idx, &filenames, &file_rows]
+            { file_rows[idx] = count_nn_rows(filenames[idx]); });
+    }
+    pool.wait();
+    vector<size_t> first_row(num_files, 0);
+    size_t num_rows = 0;
+    for (size_t i = 0; i < num_files; i++)
+    {
+        first_row[i] = num_rows;
+        num_rows += file_rows[i];
+    }
+    // Write the header and size the file so threads can write in place
+    DatasetFileHeader header{};
+    std::memcpy(header.magic, DATASET_FILE_MAGIC, sizeof(header.magic));
+    header.version = DATASET_FILE_VERSION;
+    header.endian_marker = ENDIAN_MARKER;
+    header.feature_schema_version = NN_FEATURE_SCHEMA_VERSION;
+    header.num_columns = NN_VECTOR_SIZE;
+    header.num_inputs = NN_INPUT_SIZE;
+    header.value_size = sizeof(float);
+    header.num_rows = num_rows;
+    {
+        std::ofstream fs(write_filename, std::ios::binary | std::ios::trunc);
+        fs.write(reinterpret_cast<char*>(&header), sizeof(header));
+        if (!fs)
+        {
+            throw std::runtime_error("Failed to write " + write_filename);
+        }
+    }
+    std::filesystem::resize_file(write_filename,
+        sizeof(header) + row_size * num_rows);
+    // Encode and write the rows of each file
+    for (size_t idx = 0; idx < num_files; idx++)
+    {
+        pool.submit([&, idx]
+            {
+                vector<float> rows(file_rows[idx] * NN_VECTOR_SIZE);
+                float* row = rows.data();
+                float* const rows_end = rows.data() + rows.size();
+                const string changed = filenames[idx] +
+                    " changed while it was being exported!";
+                for_each_recorded_state(filenames[idx],
+                    [&row, rows_end, &changed](const GameState& gs)
+                    {
+                        // The file must still have the rows counted above
+                        if (row == rows_end)
+                        {
+                            throw std::runtime_error(changed);
+                        }
+                        encode_nn_inputs(gs, row);
+                        encode_nn_labels(gs, row + NN_INPUT_SIZE);
+                        row += NN_VECTOR_SIZE;
+                    });
+                if (row != rows_end)
+                {
+                    throw std::runtime_error(changed);
+                }
+                std::fstream fs(write_filename,
+                    std::ios::in | std::ios::out | std::ios::binary);
+                fs.seekp(static_cast<std::streamoff>(
+                    sizeof(header) + row_size * first_row[idx]));
+                fs.write(reinterpret_cast<char*>(rows.data()),
+                    static_cast<std::streamsize>(row_size * file_rows[idx]));
+                fs.flush();
+                if (!fs)
+                {
+                    throw std::runtime_error("Failed to write the rows of " +
+                        filenames[idx] + " to " + write_filename);
+                }
+            });
+    }
+    pool.wait();
+    return num_rows;
+}
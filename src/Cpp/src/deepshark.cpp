@@ -5,20 +5,22 @@
 /* Headers
 ******************************************************************************/
 // C++ standard library
-#include <algorithm>                // For std::copy()
-#include <condition_variable>
+#include <algorithm>                // For std::min(), std::max()
+#include <exception>
 #include <iostream>
-#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <thread>
 #include <utility>                  // For std::to_underlying()
 #include <vector>
 // Project headers
+#include "dataset.hpp"
 #include "deepshark.hpp"
 #include "player.hpp"
+#include "preflop.hpp"
 #include "serialize.hpp"
 #include "texasholdem.hpp"
+#include "thread_pool.hpp"
 // Using statements
 using std::cout;
 using std::endl;
@@ -34,28 +36,18 @@ int add_ints(int x, int y)
     return x + y;
 }
 
-std::mutex thread_count_mutex;
-std::condition_variable thread_cv;
-unsigned thread_count = 0;
-unsigned max_threads;
-
-void run_tournament_thread(int thread_index, tourn_data data)
+void run_tournament(int tournament_number, const tourn_data& data)
 {
     TexasHoldEm the(
         data.player_ai_types,
         data.num_players,
         data.seed,
-        thread_index,  // Tournament #
+        tournament_number,
         data.debug,
         data.num_games_per_blind_level,
         data.tourn_directory
     );
     the.begin_tournament();
-    std::unique_lock<std::mutex> lck(thread_count_mutex);
-    thread_count--;
-    //cout << "Tournament " << thread_index << " completed!" << endl;
-    lck.unlock();
-    thread_cv.notify_one();
 }
 
 int run_tournaments(
@@ -70,43 +62,43 @@ int run_tournaments(
 )
 {
     // Multithreading options
-    const unsigned processor_count = std::thread::hardware_concurrency();
-    if (num_processors > processor_count / 2 - 2)
+    const unsigned processor_count =
+        std::max(std::thread::hardware_concurrency(), 1u);
+    if (num_processors == 0 || num_processors > processor_count)
     {
-        return -1;  // Too many processors being requested
+        return -1;  // Invalid number of processors requested
     }
-    max_threads = num_processors;
-    vector<std::thread> threads(num_tournaments);
-    // Begin tournaments
-    std::unique_lock<std::mutex> lck(thread_count_mutex);
-    for (int i = 0; i < num_tournaments; i++)
-    {
-        // THE constructor arguments
-        try {
-            tourn_data data(
+    // THE constructor arguments
+    vector<tourn_data> data;
+    try {
+        for (int i = 0; i < num_tournaments; i++)
+        {
+            data.push_back(tourn_data(
                 num_players,
                 player_ai_types,
                 num_games_per_blind_level,
                 seeds[i],
                 tourn_directory,
                 debug
-            );
-            // Create thread
-            threads[i] = std::thread(run_tournament_thread, i, data);
-        }
-        catch (const std::invalid_argument& e) {
-            return -1;  // Invalid AI type
-        }
-        thread_count++;
-        if (thread_count == max_threads)
-        {
-            thread_cv.wait(lck, [] { return thread_count < max_threads; });
+            ));
         }
     }
-    lck.unlock();
-    for (auto& th : threads)
+    catch (const std::invalid_argument& e) {
+        return -1;  // Invalid AI type
+    }
+    // Begin tournaments
+    ThreadPool pool(std::min<unsigned>(num_processors,
+        static_cast<unsigned>(std::max(num_tournaments, 1))));
+    for (int i = 0; i < num_tournaments; i++)
     {
-        th.join();
+        pool.submit([i, &data] { run_tournament(i, data[i]); });
+    }
+    try {
+        pool.wait();
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << endl;
+        return -1;  // Tournament failed, e.g. its model could not be loaded
     }
 
     return 0;
@@ -115,7 +107,16 @@ int run_tournaments(
 void get_tournament_summary(struct tournament_summary* summary, char filename[])
 {
     string filename_str = filename;
-    TournamentHistory th = read_tournamenthistory(filename_str, true);
+    TournamentHistory th;
+    try {
+        th = read_tournamenthistory(filename_str, true);
+    }
+    catch (const std::runtime_error& e) {
+        std::cerr << e.what() << endl;
+        summary->initial_player_count = 0;  // No summary could be read
+        summary->num_games = 0;
+        return;
+    }
     summary->tournament_number = th.tournament_number;
     summary->random_seed = th.random_seed;
     summary->initial_player_count = th.initial_player_count;
@@ -133,7 +134,55 @@ void write_nn_vector_data(char read_filename[], char write_filename[])
 {
     string read_filename_str = read_filename;
     string write_filename_str = write_filename;
-    write_nn_vector_data(read_filename_str, write_filename_str);
+    try {
+        write_nn_vector_data(read_filename_str, write_filename_str);
+    }
+    catch (const std::runtime_error& e) {
+        std::cerr << e.what() << endl;
+    }
+}
+
+size_t export_nn_dataset(
+    char tourn_directory[],
+    char write_filename[],
+    unsigned num_processors
+)
+{
+    string tourn_directory_str = tourn_directory;
+    string write_filename_str = write_filename;
+    try {
+        return export_nn_dataset(
+            list_tournament_files(tourn_directory_str),
+            write_filename_str,
+            num_processors);
+    }
+    catch (const std::runtime_error& e) {
+        std::cerr << e.what() << endl;
+        return 0;  // No dataset was written
+    }
+}
+
+int generate_preflop_table(
+    char filename[],
+    int num_runs,
+    int seed,
+    unsigned num_processors
+)
+{
+    // Multithreading options
+    const unsigned processor_count =
+        std::max(std::thread::hardware_concurrency(), 1u);
+    if (num_processors == 0 || num_processors > processor_count)
+    {
+        return -1;  // Invalid number of processors requested
+    }
+    PreflopEquityTable table = generate_preflop_equity_table(
+        num_runs, seed, num_processors);
+    if (!table.save(filename))
+    {
+        return -1;  // Could not write the table
+    }
+    return 0;
 }
 
 // int main()
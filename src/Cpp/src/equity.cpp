@@ -0,0 +1,730 @@
+/******************************************************************************
+* Define a standalone equity calculator.
+*
+* Equity is either sampled or enumerated exactly.  Each sampled run deals the
+* missing community cards and the opponents' hole cards directly from a
+* partial deck and compares evaluator keys.  No players, pots, or game states
+* are created, so a run costs little more than evaluating one hand per player.
+* When few cards remain to be dealt, every possible deal is enumerated
+* instead, which gives the exact equity without sampling noise.
+******************************************************************************/
+
+/* Headers
+******************************************************************************/
+// C++ standard library
+#include <algorithm> // For std::min(), std::next_permutation()
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstdint>
+#include <memory> // For make_shared and unique_ptr
+#include <random> // For mt19937
+#include <mutex>
+#include <utility> // For pair and swap()
+#include <vector>
+// Project headers
+#include "cards.hpp"
+#include "constants.hpp"
+#include "equity.hpp"
+#include "evaluator.hpp"
+#include "random.hpp"
+#include "thread_pool.hpp"
+// Using statements
+using std::array;
+using std::pair;
+using std::uint32_t;
+using std::uint64_t;
+using std::vector;
+using namespace constants;
+
+/* Constants and Enums
+******************************************************************************/
+// Enumerate exactly if it costs at most this many times the work of sampling
+constexpr double ENUMERATION_WORK_RATIO = 50;
+
+/* Helper Functions
+******************************************************************************/
+static std::unique_ptr<ThreadPool>& equity_pool()
+{
+    static std::unique_ptr<ThreadPool> pool;
+    return pool;
+}
+
+static int build_unseen_deck(const CardMask& known, PackedDeck& deck)
+{
+    /**
+     * Fill deck with the cards not in known, and return the number of cards.
+    */
+    int deck_size = 0;
+    for (int idx = 0; idx < NUMBER_CARDS_IN_DECK; idx++)
+    {
+        if (!known.contains(index_to_card(idx)))
+        {
+            deck[deck_size++] = static_cast<std::uint8_t>(idx);
+        }
+    }
+    return deck_size;
+}
+
+static void record_outcome(EquityResult& result, bool hero_lost, int num_tied)
+{
+    result.num_runs++;
+    if (hero_lost) { return; }
+    if (num_tied == 0)
+    {
+        result.wins++;
+    }
+    else
+    {
+        result.ties++;
+        result.tie_share += 1.0 / (num_tied + 1);
+    }
+}
+
+static double choose(int n, int k)
+{
+    double combinations = 1;
+    for (int i = 0; i < k; i++)
+    {
+        combinations = combinations * (n - i) / (i + 1);
+    }
+    return combinations;
+}
+
+static double estimate_enumeration_work(
+    int num_unseen,
+    int num_board_cards,
+    int num_opponents)
+{
+    /**
+     * Estimate the evaluations and comparisons needed to enumerate equity.
+     *
+     * For each board completion, every remaining hole card pair is evaluated
+     * once, and then every unordered set of opponent hands is compared.
+    */
+    double boards = choose(num_unseen, num_board_cards);
+    int remaining = num_unseen - num_board_cards;
+    double pairs = choose(remaining, 2);
+    double opponent_hands = 1;
+    for (int i = 0; i < num_opponents; i++)
+    {
+        opponent_hands = opponent_hands * choose(remaining - 2 * i, 2) / (i + 1);
+    }
+    return boards * (1 + pairs + opponent_hands);
+}
+
+static bool prefer_enumeration(
+    const vector<Card>& board,
+    int num_opponents,
+    int num_runs)
+{
+    /**
+     * Return true if enumerating every deal costs at most
+     * ENUMERATION_WORK_RATIO times the work of sampling num_runs deals.
+    */
+    const int num_unseen = NUMBER_CARDS_IN_DECK - 2 - static_cast<int>(board.size());
+    const int num_board_cards = MAX_CARDS_IN_HAND - static_cast<int>(board.size());
+    double enumeration_work = estimate_enumeration_work(
+        num_unseen, num_board_cards, num_opponents);
+    double sampling_work = static_cast<double>(num_runs) * (num_opponents + 1);
+    return enumeration_work <= ENUMERATION_WORK_RATIO * sampling_work;
+}
+
+/* EquityResult Method Definitions
+******************************************************************************/
+double EquityResult::equity() const
+{
+    /**
+     * Return the hero's expected share of the pot, counting split pots.
+    */
+    if (num_runs == 0) { return 0; }
+    return (static_cast<double>(wins) + tie_share) /
+        static_cast<double>(num_runs);
+}
+
+double EquityResult::win_probability() const
+{
+    /**
+     * Return the probability that the hero wins the pot outright.
+    */
+    if (num_runs == 0) { return 0; }
+    return static_cast<double>(wins) / static_cast<double>(num_runs);
+}
+
+EquityResult& EquityResult::operator+=(const EquityResult& other)
+{
+    /**
+     * Merge the runs of another calculation of the same situation.
+    */
+    num_runs += other.num_runs;
+    wins += other.wins;
+    ties += other.ties;
+    tie_share += other.tie_share;
+    exact = exact && other.exact;
+    return *this;
+}
+
+/* Equity Function Definitions
+******************************************************************************/
+template<typename URBG>
+EquityResult calculate_equity(
+    const pair<Card, Card>& hole_cards,
+    const vector<Card>& board,
+    int num_opponents,
+    int num_runs,
+    URBG& rng)
+{
+    /**
+     * Calculate the hero's equity, enumerating exactly when it is cheap.
+     *
+     * The work of enumerating every remaining deal is estimated and compared
+     * to the work of sampling num_runs deals.  Exact enumeration is chosen
+     * unless it would cost more than ENUMERATION_WORK_RATIO times as much,
+     * which in practice selects it for the turn and river against few
+     * opponents.
+     *
+     * @param hole_cards are the hero's hole cards.
+     * @param board are the community cards dealt so far (zero to five).
+     * @param num_opponents is the number of opponents still in the hand.
+     * @param num_runs is the number of random deals to simulate if sampling.
+     * @param rng is the random number generator used to deal the cards.
+     * @return The number of wins and ties over all enumerated or simulated
+     *         deals.
+    */
+    if (prefer_enumeration(board, num_opponents, num_runs))
+    {
+        return enumerate_equity(hole_cards, board, num_opponents);
+    }
+    return sample_equity(hole_cards, board, num_opponents, num_runs, rng);
+}
+
+EquityResult calculate_equity(
+    const pair<Card, Card>& hole_cards,
+    const vector<Card>& board,
+    int num_opponents,
+    int num_runs,
+    const StreamRng& rng,
+    ThreadPool* pool)
+{
+    /**
+     * Calculate the hero's equity, sampling on several threads if needed.
+     *
+     * Chooses between enumeration and sampling like the single-threaded
+     * overload, but samples with the parallel sample_equity().
+     *
+     * @param hole_cards are the hero's hole cards.
+     * @param board are the community cards dealt so far (zero to five).
+     * @param num_opponents is the number of opponents still in the hand.
+     * @param num_runs is the number of random deals to simulate if sampling.
+     * @param rng is the stream the random number streams are split from.
+     * @param pool runs streams alongside the calling thread, or is nullptr.
+     * @return The number of wins and ties over all enumerated or simulated
+     *         deals.
+    */
+    if (prefer_enumeration(board, num_opponents, num_runs))
+    {
+        return enumerate_equity(hole_cards, board, num_opponents);
+    }
+    return sample_equity(hole_cards, board, num_opponents, num_runs, rng, pool);
+}
+
+template<typename URBG>
+EquityResult sample_equity(
+    const pair<Card, Card>& hole_cards,
+    const vector<Card>& board,
+    int num_opponents,
+    int num_runs,
+    URBG& rng)
+{
+    /**
+     * Estimate the hero's equity against random opponent hands.
+     *
+     * @param hole_cards are the hero's hole cards.
+     * @param board are the community cards dealt so far (zero to five).
+     * @param num_opponents is the number of opponents still in the hand.
+     * @param num_runs is the number of random deals to simulate.
+     * @param rng is the random number generator used to deal the cards.
+     * @return The number of wins and ties over all simulated deals.
+    */
+    assert((board.size() <= MAX_CARDS_IN_HAND) &&
+        "Board cannot have more than five cards!");
+    assert((num_opponents >= 1 && num_opponents < MAX_PLAYER_COUNT) &&
+        "Number of opponents must be between 1 and 9!");
+    CardMask board_mask;
+    for (const auto& c : board)
+    {
+        board_mask.add_card(c);
+    }
+    CardMask hero_mask = board_mask;
+    hero_mask.add_card(hole_cards.first);
+    hero_mask.add_card(hole_cards.second);
+    PackedDeck deck;
+    int deck_size = build_unseen_deck(hero_mask, deck);
+    const int num_board_cards = MAX_CARDS_IN_HAND - static_cast<int>(board.size());
+    const int num_draws = num_board_cards + 2 * num_opponents;
+    EquityResult result;
+    for (int run = 0; run < num_runs; run++)
+    {
+        // Shuffle only the cards that will be dealt
+        partial_shuffle(deck.data(), deck_size, num_draws, rng);
+        CardMask run_board = board_mask;
+        CardMask run_hero = hero_mask;
+        for (int i = 0; i < num_board_cards; i++)
+        {
+            run_board.add_card_index(deck[i]);
+            run_hero.add_card_index(deck[i]);
+        }
+        uint32_t hero_key = evaluate_hand(run_hero).key;
+        int num_tied = 0;
+        bool hero_lost = false;
+        for (int opp = 0; opp < num_opponents; opp++)
+        {
+            CardMask run_opp = run_board;
+            run_opp.add_card_index(deck[num_board_cards + 2 * opp]);
+            run_opp.add_card_index(deck[num_board_cards + 2 * opp + 1]);
+            uint32_t opp_key = evaluate_hand(run_opp).key;
+            if (opp_key > hero_key)
+            {
+                hero_lost = true;
+                break;
+            }
+            if (opp_key == hero_key) { num_tied++; }
+        }
+        record_outcome(result, hero_lost, num_tied);
+    }
+    return result;
+}
+
+EquityResult sample_equity(
+    const pair<Card, Card>& hole_cards,
+    const vector<Card>& board,
+    int num_opponents,
+    int num_runs,
+    const StreamRng& rng,
+    ThreadPool* pool)
+{
+    /**
+     * Estimate the hero's equity with the runs split across threads.
+     *
+     * The runs are split into EQUITY_ROLLOUT_STREAMS streams, and stream i
+     * deals from rng.split(i).  The calling thread and the pool's workers
+     * take streams one at a time, and the results are merged once every
+     * stream is done, so the result is bit-identical for any number of
+     * threads, including none but the caller.
+     *
+     * @param hole_cards are the hero's hole cards.
+     * @param board are the community cards dealt so far (zero to five).
+     * @param num_opponents is the number of opponents still in the hand.
+     * @param num_runs is the number of random deals to simulate.
+     * @param rng is the stream the random number streams are split from.
+     * @param pool runs streams alongside the calling thread, or is nullptr.
+     * @return The number of wins and ties over all simulated deals.
+    */
+    struct Rollouts
+    {
+        pair<Card, Card> hole_cards;
+        vector<Card> board;
+        int num_opponents;
+        int num_runs;
+        StreamRng rng;
+        std::atomic<int> next_stream = 0;
+        array<EquityResult, EQUITY_ROLLOUT_STREAMS> results;
+        int num_done = 0;
+        std::mutex mutex;
+        std::condition_variable done_cv;
+    };
+    // Shared so helpers that start after the query has finished stay valid
+    auto rollouts = std::make_shared<Rollouts>();
+    rollouts->hole_cards = hole_cards;
+    rollouts->board = board;
+    rollouts->num_opponents = num_opponents;
+    rollouts->num_runs = num_runs;
+    rollouts->rng = rng;
+    auto run_streams = [rollouts]()
+        {
+            Rollouts& r = *rollouts;
+            for (int stream = r.next_stream++; stream < EQUITY_ROLLOUT_STREAMS;
+                stream = r.next_stream++)
+            {
+                int first_run = r.num_runs * stream / EQUITY_ROLLOUT_STREAMS;
+                int last_run = r.num_runs * (stream + 1) / EQUITY_ROLLOUT_STREAMS;
+                StreamRng stream_rng = r.rng.split(static_cast<uint64_t>(stream));
+                r.results[stream] = sample_equity(r.hole_cards, r.board,
+                    r.num_opponents, last_run - first_run, stream_rng);
+                std::lock_guard<std::mutex> lck(r.mutex);
+                if (++r.num_done == EQUITY_ROLLOUT_STREAMS)
+                {
+                    r.done_cv.notify_all();
+                }
+            }
+        };
+    unsigned num_helpers = pool == nullptr ? 0 :
+        std::min<unsigned>(pool->size(), EQUITY_ROLLOUT_STREAMS - 1);
+    for (unsigned i = 0; i < num_helpers; i++)
+    {
+        pool->submit(run_streams);
+    }
+    run_streams();
+    std::unique_lock<std::mutex> lck(rollouts->mutex);
+    rollouts->done_cv.wait(lck,
+        [&rollouts] { return rollouts->num_done == EQUITY_ROLLOUT_STREAMS; });
+    EquityResult result;
+    for (const auto& stream_result : rollouts->results)
+    {
+        result += stream_result;
+    }
+    return result;
+}
+
+// Explicit instantiations
+template EquityResult calculate_equity(
+    const pair<Card, Card>&, const vector<Card>&, int, int, std::mt19937&);
+template EquityResult calculate_equity(
+    const pair<Card, Card>&, const vector<Card>&, int, int, StreamRng&);
+template EquityResult sample_equity(
+    const pair<Card, Card>&, const vector<Card>&, int, int, std::mt19937&);
+template EquityResult sample_equity(
+    const pair<Card, Card>&, const vector<Card>&, int, int, StreamRng&);
+
+/* Exact Enumeration
+******************************************************************************/
+struct OpponentHand
+{
+    // Indices of the hole cards in the unseen deck and the hand strength key
+    int card1;
+    int card2;
+    uint32_t key;
+};
+
+static void enumerate_opponents(
+    const vector<OpponentHand>& hands,
+    size_t start,
+    int opponents_left,
+    uint64_t used_cards,
+    uint32_t hero_key,
+    bool hero_lost,
+    int num_tied,
+    EquityResult& result)
+{
+    /**
+     * Visit every unordered set of disjoint opponent hands once.
+     *
+     * Hands are chosen in increasing index order so that each set of hands is
+     * counted exactly once.
+    */
+    if (opponents_left == 0)
+    {
+        record_outcome(result, hero_lost, num_tied);
+        return;
+    }
+    for (size_t h = start; h < hands.size(); h++)
+    {
+        const auto& hand = hands[h];
+        uint64_t hand_cards = (1ull << hand.card1) | (1ull << hand.card2);
+        if (used_cards & hand_cards) { continue; }
+        enumerate_opponents(
+            hands,
+            h + 1,
+            opponents_left - 1,
+            used_cards | hand_cards,
+            hero_key,
+            hero_lost || hand.key > hero_key,
+            num_tied + (hand.key == hero_key ? 1 : 0),
+            result);
+    }
+}
+
+static void enumerate_boards(
+    const PackedDeck& deck,
+    int deck_size,
+    int start,
+    int board_cards_left,
+    uint64_t used_cards,
+    const CardMask& board_mask,
+    const CardMask& hero_mask,
+    int num_opponents,
+    vector<OpponentHand>& hands,
+    vector<CardMask>& hole_masks,
+    vector<uint32_t>& keys,
+    EquityResult& result)
+{
+    /**
+     * Visit every completion of the board, then every set of opponent hands.
+     *
+     * hole_masks and keys are scratch storage for evaluating every possible
+     * opponent hand as one batch.
+    */
+    if (board_cards_left > 0)
+    {
+        for (int i = start; i < deck_size; i++)
+        {
+            CardMask next_board = board_mask;
+            CardMask next_hero = hero_mask;
+            next_board.add_card_index(deck[i]);
+            next_hero.add_card_index(deck[i]);
+            enumerate_boards(deck, deck_size, i + 1, board_cards_left - 1,
+                used_cards | (1ull << i), next_board, next_hero,
+                num_opponents, hands, hole_masks, keys, result);
+        }
+        return;
+    }
+    uint32_t hero_key = evaluate_hand(hero_mask).key;
+    // Evaluate every possible opponent hand once for this board
+    hands.clear();
+    hole_masks.clear();
+    for (int i = 0; i < deck_size; i++)
+    {
+        if (used_cards & (1ull << i)) { continue; }
+        for (int j = i + 1; j < deck_size; j++)
+        {
+            if (used_cards & (1ull << j)) { continue; }
+            CardMask opp_mask;
+            opp_mask.add_card_index(deck[i]);
+            opp_mask.add_card_index(deck[j]);
+            hole_masks.push_back(opp_mask);
+            hands.push_back({ i, j, 0 });
+        }
+    }
+    keys.resize(hole_masks.size());
+    evaluate_hands(board_mask, hole_masks.data(), hole_masks.size(),
+        keys.data());
+    for (size_t k = 0; k < hands.size(); k++)
+    {
+        hands[k].key = keys[k];
+    }
+    enumerate_opponents(hands, 0, num_opponents, used_cards, hero_key,
+        false, 0, result);
+}
+
+EquityResult enumerate_equity(
+    const pair<Card, Card>& hole_cards,
+    const vector<Card>& board,
+    int num_opponents)
+{
+    /**
+     * Calculate the hero's exact equity by enumerating every possible deal.
+     *
+     * Every completion of the board and every set of opponent hole cards is
+     * equally likely, so the counts are exact.  The number of deals grows
+     * rapidly with the number of unknown cards; use calculate_equity() to
+     * fall back on sampling when the enumeration would be too large.
+     *
+     * @param hole_cards are the hero's hole cards.
+     * @param board are the community cards dealt so far (zero to five).
+     * @param num_opponents is the number of opponents still in the hand.
+     * @return The number of wins and ties over all possible deals.
+    */
+    assert((board.size() <= MAX_CARDS_IN_HAND) &&
+        "Board cannot have more than five cards!");
+    assert((num_opponents >= 1 && num_opponents < MAX_PLAYER_COUNT) &&
+        "Number of opponents must be between 1 and 9!");
+    CardMask board_mask;
+    for (const auto& c : board)
+    {
+        board_mask.add_card(c);
+    }
+    CardMask hero_mask = board_mask;
+    hero_mask.add_card(hole_cards.first);
+    hero_mask.add_card(hole_cards.second);
+    PackedDeck deck;
+    int deck_size = build_unseen_deck(hero_mask, deck);
+    const int num_board_cards = MAX_CARDS_IN_HAND - static_cast<int>(board.size());
+    vector<OpponentHand> hands;
+    vector<CardMask> hole_masks;
+    vector<uint32_t> keys;
+    EquityResult result;
+    result.exact = true;
+    enumerate_boards(deck, deck_size, 0, num_board_cards, 0, board_mask,
+        hero_mask, num_opponents, hands, hole_masks, keys, result);
+    return result;
+}
+
+/* Equity Cache
+******************************************************************************/
+void EquityCache::clear()
+{
+    std::lock_guard<std::mutex> lck(m_mutex);
+    m_entries.clear();
+    m_index.clear();
+    m_hits = 0;
+    m_misses = 0;
+}
+
+uint64_t EquityCache::hits() const
+{
+    return m_hits;
+}
+
+void EquityCache::insert(uint64_t key, double equity)
+{
+    /**
+     * Store an equity, evicting the least recently used entry if full.
+    */
+    std::lock_guard<std::mutex> lck(m_mutex);
+    auto it = m_index.find(key);
+    if (it != m_index.end())
+    {
+        // Another thread computed the same equity first
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return;
+    }
+    if (m_capacity == 0) { return; }
+    if (m_entries.size() >= m_capacity)
+    {
+        m_index.erase(m_entries.back().first);
+        m_entries.pop_back();
+    }
+    m_entries.emplace_front(key, equity);
+    m_index[key] = m_entries.begin();
+}
+
+bool EquityCache::lookup(uint64_t key, double& equity)
+{
+    /**
+     * Look up an equity and count the hit or miss.
+     *
+     * @param key is the value returned by equity_cache_key().
+     * @param equity is set to the cached equity on a hit.
+     * @return True if the equity was in the cache.
+    */
+    std::lock_guard<std::mutex> lck(m_mutex);
+    auto it = m_index.find(key);
+    if (it == m_index.end())
+    {
+        m_misses++;
+        return false;
+    }
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    equity = it->second->second;
+    m_hits++;
+    return true;
+}
+
+uint64_t EquityCache::misses() const
+{
+    return m_misses;
+}
+
+size_t EquityCache::size() const
+{
+    std::lock_guard<std::mutex> lck(m_mutex);
+    return m_entries.size();
+}
+
+void canonicalize_suits(pair<Card, Card>& hole_cards, vector<Card>& board)
+{
+    /**
+     * Relabel suits so that suit-isomorphic situations have identical cards.
+     *
+     * Relabelling suits does not change the strength of any hand, so two
+     * situations that differ only by suits have the same equity.  Each of
+     * the 24 suit permutations is applied, the hole cards and the board are
+     * each sorted, and the permutation giving the smallest sequence of card
+     * indices is kept.
+     *
+     * @param hole_cards are the hero's hole cards, relabelled in place.
+     * @param board are the community cards, relabelled and sorted in place.
+    */
+    assert((board.size() <= MAX_CARDS_IN_HAND) &&
+        "Board cannot have more than five cards!");
+    const size_t num_board_cards = std::min(board.size(), size_t{ MAX_CARDS_IN_HAND });
+    const size_t num_cards = 2 + num_board_cards;
+    array<int, MAX_CARDS_IN_HAND + 2> cards{};
+    cards[0] = card_index(hole_cards.first);
+    cards[1] = card_index(hole_cards.second);
+    for (size_t i = 0; i < num_board_cards; i++)
+    {
+        cards[i + 2] = card_index(board[i]);
+    }
+    array<int, NUMBER_SUITS> perm = { 0, 1, 2, 3 };
+    array<int, MAX_CARDS_IN_HAND + 2> best;
+    best.fill(NUMBER_CARDS_IN_DECK);
+    do
+    {
+        array<int, MAX_CARDS_IN_HAND + 2> relabelled{};
+        for (size_t i = 0; i < num_cards; i++)
+        {
+            relabelled[i] = perm[cards[i] / NUMBER_CARDS_IN_SUIT] *
+                NUMBER_CARDS_IN_SUIT + cards[i] % NUMBER_CARDS_IN_SUIT;
+        }
+        // Insertion sort the hole cards and the board separately
+        if (relabelled[1] < relabelled[0]) { std::swap(relabelled[0], relabelled[1]); }
+        for (size_t i = 3; i < num_cards; i++)
+        {
+            for (size_t j = i; j > 2 && relabelled[j] < relabelled[j - 1]; j--)
+            {
+                std::swap(relabelled[j], relabelled[j - 1]);
+            }
+        }
+        if (relabelled < best) { best = relabelled; }
+    } while (std::next_permutation(perm.begin(), perm.end()));
+    hole_cards = { index_to_card(best[0]), index_to_card(best[1]) };
+    for (size_t i = 0; i < num_board_cards; i++)
+    {
+        board[i] = index_to_card(best[i + 2]);
+    }
+}
+
+uint64_t equity_cache_key(
+    const pair<Card, Card>& hole_cards,
+    const vector<Card>& board,
+    int num_opponents,
+    int num_runs)
+{
+    /**
+     * Pack a situation into a key for the equity cache.
+     *
+     * The cards should first be passed through canonicalize_suits().  Each
+     * card takes six bits (zero for no card), followed by four bits for the
+     * number of opponents and the remaining bits for the number of runs.
+    */
+    uint64_t key = 0;
+    key = key << 6 | static_cast<uint64_t>(card_index(hole_cards.first) + 1);
+    key = key << 6 | static_cast<uint64_t>(card_index(hole_cards.second) + 1);
+    for (size_t i = 0; i < MAX_CARDS_IN_HAND; i++)
+    {
+        uint64_t card = (i < board.size()) ?
+            static_cast<uint64_t>(card_index(board[i]) + 1) : 0;
+        key = key << 6 | card;
+    }
+    key = key << 4 | static_cast<uint64_t>(num_opponents);
+    return key | static_cast<uint64_t>(num_runs) << 46;
+}
+
+EquityCache& flop_equity_cache()
+{
+    /**
+     * Return the process-wide cache of flop equities.
+    */
+    static EquityCache cache;
+    return cache;
+}
+
+void set_equity_threads(unsigned num_threads)
+{
+    /**
+     * Set the number of threads each Monte Carlo equity query runs on.
+     *
+     * With more than one thread, HeuristicAI::run_mc_sim() splits its runs
+     * across the calling thread and a pool of num_threads - 1 workers.  This
+     * is meant for a single table, since tournaments run in parallel already
+     * keep every core busy.  Results are the same for any number of
+     * threads.  Must not be called while games are being played.
+    */
+    std::unique_ptr<ThreadPool>& pool = equity_pool();
+    pool.reset();
+    if (num_threads > 1)
+    {
+        pool = std::make_unique<ThreadPool>(num_threads - 1);
+    }
+}
+
+ThreadPool* equity_thread_pool()
+{
+    /**
+     * Return the pool equity queries run on, or nullptr if they run on the
+     * calling thread only.
+    */
+    return equity_pool().get();
+}
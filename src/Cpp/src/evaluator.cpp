@@ -0,0 +1,645 @@
+/******************************************************************************
+* Define a table-driven poker hand evaluator.
+*
+* Cards are accumulated into one 13-bit rank mask per suit.  Flushes,
+* straights, and kickers are then resolved with two precomputed lookup tables
+* indexed by a rank mask, and rank multiplicities (pairs, trips, quads) are
+* found by intersecting the suit masks.  No memory is allocated and no cards
+* are sorted while evaluating a hand.
+*
+* Hands that share a board can also be evaluated in batches.  With AVX2, eight
+* hands are evaluated at once, one per 32-bit lane: the suit counts, rank
+* multiplicities and table lookups are all done in vector registers, and the
+* key of every hand category is computed for every lane.  Since the category
+* is the most significant part of a key, the strength of each hand is the
+* largest key among the categories the hand actually contains.
+******************************************************************************/
+
+/* Headers
+******************************************************************************/
+// C++ standard library
+#include <algorithm>    // For std::copy_n(), std::min()
+#include <array>
+#include <bit>          // For std::popcount() and std::bit_width()
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>      // For std::to_underlying()
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>  // For AVX2 intrinsics
+#endif
+// Project headers
+#include "cards.hpp"
+#include "constants.hpp"
+#include "evaluator.hpp"
+// Using statements
+using std::array;
+using std::to_underlying;
+using std::uint16_t;
+using std::uint32_t;
+using std::vector;
+using namespace constants;
+
+/* Constants and Enums
+******************************************************************************/
+enum class Category : uint32_t
+{
+    // Ordered by poker hand strength, unlike HandRank which orders wheels
+    // by the order they were implemented
+    High_Card,
+    Pair,
+    Two_Pair,
+    Three_of_a_Kind,
+    Straight,
+    Flush,
+    Full_House,
+    Four_of_a_Kind,
+    Straight_Flush
+};
+
+constexpr int RANK_MASK_COUNT = 1 << NUMBER_CARDS_IN_SUIT;
+constexpr int CATEGORY_SHIFT = 20;
+constexpr uint32_t WHEEL_MASK = 0b1000000001111;  // A, 5, 4, 3, 2
+
+constexpr array<uint32_t, RANK_MASK_COUNT> STRAIGHT_TABLE = []
+    {
+        // Maps a rank mask to the rank of the top card of its highest straight,
+        // or zero if the mask does not contain a straight.
+        array<uint32_t, RANK_MASK_COUNT> table{};
+        for (uint32_t mask = 0; mask < RANK_MASK_COUNT; mask++)
+        {
+            for (uint32_t top = NUMBER_CARDS_IN_SUIT - 1; top >= 4; top--)
+            {
+                uint32_t run = 0b11111u << (top - 4);
+                if ((mask & run) == run)
+                {
+                    table[mask] = top + 2;
+                    break;
+                }
+            }
+            if (table[mask] == 0 && (mask & WHEEL_MASK) == WHEEL_MASK)
+            {
+                table[mask] = to_underlying(Rank::Five);
+            }
+        }
+        return table;
+    }();
+
+constexpr array<uint32_t, RANK_MASK_COUNT> TOP_FIVE_TABLE = []
+    {
+        // Maps a rank mask to the ranks of its (up to) five highest cards,
+        // packed four bits per rank with the highest rank in bits 16-19.
+        array<uint32_t, RANK_MASK_COUNT> table{};
+        for (uint32_t mask = 0; mask < RANK_MASK_COUNT; mask++)
+        {
+            uint32_t packed = 0;
+            uint32_t count = 0;
+            for (int bit = NUMBER_CARDS_IN_SUIT - 1; bit >= 0 && count < 5; bit--)
+            {
+                if (mask & (1u << bit))
+                {
+                    packed |= static_cast<uint32_t>(bit + 2) << (4 * (4 - count));
+                    count++;
+                }
+            }
+            table[mask] = packed;
+        }
+        return table;
+    }();
+
+/* Helper Functions
+******************************************************************************/
+static uint32_t top_ranks(uint32_t mask, int count)
+{
+    /**
+     * Return the packed ranks of the highest count cards in the rank mask.
+    */
+    return TOP_FIVE_TABLE[mask] >> (4 * (MAX_CARDS_IN_HAND - count));
+}
+
+static uint32_t top_rank(uint32_t mask)
+{
+    return static_cast<uint32_t>(std::bit_width(mask)) + 1;
+}
+
+static uint32_t rank_bit(uint32_t rank)
+{
+    return 1u << (rank - 2);
+}
+
+static HandStrength make_strength(Category category, uint32_t ranks)
+{
+    /**
+     * Pack the category and card ranks into a key and map it to a HandRank.
+    */
+    HandStrength hs;
+    hs.key = (to_underlying(category) << CATEGORY_SHIFT) | ranks;
+    uint32_t high_rank = (ranks >> 16) & 0xF;
+    switch (category)
+    {
+    case Category::High_Card:
+        hs.hand_rank = HandRank::High_Card;
+        break;
+    case Category::Pair:
+        hs.hand_rank = HandRank::Pair;
+        break;
+    case Category::Two_Pair:
+        hs.hand_rank = HandRank::Two_Pair;
+        break;
+    case Category::Three_of_a_Kind:
+        hs.hand_rank = HandRank::Three_of_a_Kind;
+        break;
+    case Category::Straight:
+        hs.hand_rank = (high_rank == to_underlying(Rank::Five)) ?
+            HandRank::Wheel_Straight : HandRank::Straight;
+        break;
+    case Category::Flush:
+        hs.hand_rank = HandRank::Flush;
+        break;
+    case Category::Full_House:
+        hs.hand_rank = HandRank::Full_House;
+        break;
+    case Category::Four_of_a_Kind:
+        hs.hand_rank = HandRank::Four_of_a_Kind;
+        break;
+    case Category::Straight_Flush:
+        if (high_rank == to_underlying(Rank::Ace))
+        {
+            hs.hand_rank = HandRank::Royal_Flush;
+        }
+        else if (high_rank == to_underlying(Rank::Five))
+        {
+            hs.hand_rank = HandRank::Wheel_Straight_Flush;
+        }
+        else
+        {
+            hs.hand_rank = HandRank::Straight_Flush;
+        }
+        break;
+    }
+    return hs;
+}
+
+static uint32_t straight_ranks(uint32_t top)
+{
+    /**
+     * Pack the ranks of a straight.  The ace of a wheel is packed as a 1.
+    */
+    return (top << 16) | ((top - 1) << 12) | ((top - 2) << 8) |
+        ((top - 3) << 4) | (top - 4);
+}
+
+/* SIMD Batch Evaluation
+******************************************************************************/
+#if defined(__x86_64__) || defined(__i386__)
+constexpr size_t SIMD_LANES = 8;
+
+__attribute__((target("avx2")))
+static __m256i popcount_lanes(__m256i v)
+{
+    /**
+     * Count the set bits of each 32-bit lane with a nibble lookup table.
+    */
+    const __m256i lut = _mm256_setr_epi8(
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low_nibble = _mm256_set1_epi8(0x0F);
+    __m256i counts = _mm256_add_epi8(
+        _mm256_shuffle_epi8(lut, _mm256_and_si256(v, low_nibble)),
+        _mm256_shuffle_epi8(lut,
+            _mm256_and_si256(_mm256_srli_epi16(v, 4), low_nibble)));
+    // Sum the four byte counts of each lane into its top byte
+    return _mm256_srli_epi32(
+        _mm256_mullo_epi32(counts, _mm256_set1_epi32(0x01010101)), 24);
+}
+
+__attribute__((target("avx2")))
+static __m256i lookup_lanes(
+    const array<uint32_t, RANK_MASK_COUNT>& table,
+    __m256i masks)
+{
+    return _mm256_i32gather_epi32(
+        reinterpret_cast<const int*>(table.data()), masks, 4);
+}
+
+__attribute__((target("avx2")))
+static __m256i top_rank_lanes(__m256i masks)
+{
+    /**
+     * Return the rank of the highest card of each mask, or zero if empty.
+    */
+    return _mm256_srli_epi32(lookup_lanes(TOP_FIVE_TABLE, masks), 16);
+}
+
+__attribute__((target("avx2")))
+static __m256i rank_bit_lanes(__m256i ranks)
+{
+    // Rank zero shifts by more than 31 bits, which gives an empty mask
+    return _mm256_sllv_epi32(_mm256_set1_epi32(1),
+        _mm256_sub_epi32(ranks, _mm256_set1_epi32(2)));
+}
+
+__attribute__((target("avx2")))
+static __m256i pack_ranks_lanes(
+    __m256i r1, __m256i r2, __m256i r3, __m256i r4, __m256i r5)
+{
+    return _mm256_or_si256(
+        _mm256_or_si256(_mm256_slli_epi32(r1, 16), _mm256_slli_epi32(r2, 12)),
+        _mm256_or_si256(
+            _mm256_or_si256(_mm256_slli_epi32(r3, 8), _mm256_slli_epi32(r4, 4)),
+            r5));
+}
+
+__attribute__((target("avx2")))
+static __m256i straight_ranks_lanes(__m256i top)
+{
+    const __m256i one = _mm256_set1_epi32(1);
+    __m256i r2 = _mm256_sub_epi32(top, one);
+    __m256i r3 = _mm256_sub_epi32(r2, one);
+    __m256i r4 = _mm256_sub_epi32(r3, one);
+    return pack_ranks_lanes(top, r2, r3, r4, _mm256_sub_epi32(r4, one));
+}
+
+__attribute__((target("avx2")))
+static __m256i category_key_lanes(
+    Category category,
+    __m256i ranks,
+    __m256i condition)
+{
+    /**
+     * Return the key of a category in lanes where condition is non-zero and
+     * zero elsewhere.
+    */
+    __m256i key = _mm256_or_si256(ranks, _mm256_set1_epi32(static_cast<int>(
+        to_underlying(category) << CATEGORY_SHIFT)));
+    __m256i absent = _mm256_cmpeq_epi32(condition, _mm256_setzero_si256());
+    return _mm256_andnot_si256(absent, key);
+}
+
+__attribute__((target("avx2")))
+static __m256i evaluate_lanes(__m256i s0, __m256i s1, __m256i s2, __m256i s3)
+{
+    /**
+     * Evaluate eight hands of up to seven cards, one per lane.
+     *
+     * Mirrors evaluate_hand(), but instead of returning the first category
+     * found, computes every category and keeps the largest key.
+    */
+    const __m256i all = _mm256_or_si256(_mm256_or_si256(s0, s1),
+        _mm256_or_si256(s2, s3));
+    const __m256i s01 = _mm256_and_si256(s0, s1);
+    const __m256i s23 = _mm256_and_si256(s2, s3);
+    const __m256i quads = _mm256_and_si256(s01, s23);
+    const __m256i trips = _mm256_or_si256(
+        _mm256_and_si256(s01, _mm256_or_si256(s2, s3)),
+        _mm256_and_si256(s23, _mm256_or_si256(s0, s1)));
+    const __m256i pairs = _mm256_andnot_si256(trips, _mm256_or_si256(
+        _mm256_or_si256(s01, s23),
+        _mm256_and_si256(_mm256_or_si256(s0, s1), _mm256_or_si256(s2, s3))));
+    // The suit with at least five cards, if any
+    const __m256i four = _mm256_set1_epi32(4);
+    __m256i flush = _mm256_setzero_si256();
+    for (const __m256i suit : { s0, s1, s2, s3 })
+    {
+        flush = _mm256_or_si256(flush, _mm256_and_si256(suit,
+            _mm256_cmpgt_epi32(popcount_lanes(suit), four)));
+    }
+    // Straight flush and flush
+    __m256i top = lookup_lanes(STRAIGHT_TABLE, flush);
+    __m256i key = category_key_lanes(Category::Straight_Flush,
+        straight_ranks_lanes(top), top);
+    key = _mm256_max_epu32(key, category_key_lanes(Category::Flush,
+        lookup_lanes(TOP_FIVE_TABLE, flush), flush));
+    // Four of a kind
+    __m256i q = top_rank_lanes(quads);
+    __m256i kicker = top_rank_lanes(
+        _mm256_andnot_si256(rank_bit_lanes(q), all));
+    key = _mm256_max_epu32(key, category_key_lanes(Category::Four_of_a_Kind,
+        pack_ranks_lanes(q, q, q, q, kicker), quads));
+    // Full house and three of a kind
+    __m256i t = top_rank_lanes(trips);
+    __m256i t_bit = rank_bit_lanes(t);
+    __m256i p = top_rank_lanes(
+        _mm256_or_si256(_mm256_andnot_si256(t_bit, trips), pairs));
+    key = _mm256_max_epu32(key, category_key_lanes(Category::Full_House,
+        pack_ranks_lanes(t, t, t, p, p), _mm256_min_epu32(t, p)));
+    key = _mm256_max_epu32(key, category_key_lanes(Category::Three_of_a_Kind,
+        _mm256_or_si256(pack_ranks_lanes(t, t, t, _mm256_setzero_si256(),
+            _mm256_setzero_si256()), _mm256_srli_epi32(lookup_lanes(
+                TOP_FIVE_TABLE, _mm256_andnot_si256(t_bit, all)), 12)), t));
+    // Straight
+    top = lookup_lanes(STRAIGHT_TABLE, all);
+    key = _mm256_max_epu32(key, category_key_lanes(Category::Straight,
+        straight_ranks_lanes(top), top));
+    // Two pair and pair
+    __m256i high = top_rank_lanes(pairs);
+    __m256i high_bit = rank_bit_lanes(high);
+    __m256i low = top_rank_lanes(_mm256_andnot_si256(high_bit, pairs));
+    __m256i low_bit = rank_bit_lanes(low);
+    kicker = top_rank_lanes(_mm256_andnot_si256(
+        _mm256_or_si256(high_bit, low_bit), all));
+    key = _mm256_max_epu32(key, category_key_lanes(Category::Two_Pair,
+        pack_ranks_lanes(high, high, low, low, kicker), low));
+    key = _mm256_max_epu32(key, category_key_lanes(Category::Pair,
+        _mm256_or_si256(pack_ranks_lanes(high, high, _mm256_setzero_si256(),
+            _mm256_setzero_si256(), _mm256_setzero_si256()),
+            _mm256_srli_epi32(lookup_lanes(TOP_FIVE_TABLE,
+                _mm256_andnot_si256(high_bit, all)), 8)), high));
+    // High card
+    return _mm256_max_epu32(key, lookup_lanes(TOP_FIVE_TABLE, all));
+}
+
+__attribute__((target("avx2")))
+static void evaluate_hands_avx2(
+    const CardMask& board,
+    const CardMask* hole_cards,
+    size_t num_hands,
+    uint32_t* keys)
+{
+    for (size_t first = 0; first < num_hands; first += SIMD_LANES)
+    {
+        const size_t count = std::min(SIMD_LANES, num_hands - first);
+        // Unused lanes evaluate an empty hand
+        alignas(32) array<array<uint32_t, SIMD_LANES>, NUMBER_SUITS> suits{};
+        for (size_t lane = 0; lane < count; lane++)
+        {
+            for (int s = 0; s < NUMBER_SUITS; s++)
+            {
+                suits[s][lane] = board.suit_ranks[s] |
+                    hole_cards[first + lane].suit_ranks[s];
+            }
+        }
+        alignas(32) array<uint32_t, SIMD_LANES> lane_keys;
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lane_keys.data()),
+            evaluate_lanes(
+                _mm256_load_si256(reinterpret_cast<const __m256i*>(suits[0].data())),
+                _mm256_load_si256(reinterpret_cast<const __m256i*>(suits[1].data())),
+                _mm256_load_si256(reinterpret_cast<const __m256i*>(suits[2].data())),
+                _mm256_load_si256(reinterpret_cast<const __m256i*>(suits[3].data()))));
+        std::copy_n(lane_keys.begin(), count, keys + first);
+    }
+}
+
+static bool cpu_supports_avx2()
+{
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+}
+#endif
+
+/* Evaluator Function Definitions
+******************************************************************************/
+HandStrength evaluate_hand(const CardMask& mask)
+{
+    /**
+     * Determine the strength of the best five card hand in the mask.
+     *
+     * Valid for up to seven cards, where a flush excludes both four of a kind
+     * and a full house.
+     *
+     * @param mask contains the player's hole cards and the community cards.
+     * @return The comparable strength key and the hand rank of the best hand.
+    */
+    const uint32_t s0 = mask.suit_ranks[0];
+    const uint32_t s1 = mask.suit_ranks[1];
+    const uint32_t s2 = mask.suit_ranks[2];
+    const uint32_t s3 = mask.suit_ranks[3];
+    for (const uint32_t suit : { s0, s1, s2, s3 })
+    {
+        if (std::popcount(suit) >= MAX_CARDS_IN_HAND)
+        {
+            uint32_t top = STRAIGHT_TABLE[suit];
+            if (top) { return make_strength(Category::Straight_Flush, straight_ranks(top)); }
+            return make_strength(Category::Flush, TOP_FIVE_TABLE[suit]);
+        }
+    }
+    const uint32_t all = s0 | s1 | s2 | s3;
+    const uint32_t quads = s0 & s1 & s2 & s3;
+    if (quads)
+    {
+        uint32_t q = top_rank(quads);
+        uint32_t kicker = top_ranks(all & ~rank_bit(q), 1);
+        return make_strength(Category::Four_of_a_Kind,
+            (q << 16) | (q << 12) | (q << 8) | (q << 4) | kicker);
+    }
+    const uint32_t trips = (s0 & s1 & s2) | (s0 & s1 & s3) |
+        (s0 & s2 & s3) | (s1 & s2 & s3);
+    const uint32_t pairs = ((s0 & s1) | (s0 & s2) | (s0 & s3) |
+        (s1 & s2) | (s1 & s3) | (s2 & s3)) & ~trips;
+    if (trips)
+    {
+        // Two sets of trips or trips and a pair make a full house
+        uint32_t t = top_rank(trips);
+        uint32_t rest = (trips & ~rank_bit(t)) | pairs;
+        if (rest)
+        {
+            uint32_t p = top_rank(rest);
+            return make_strength(Category::Full_House,
+                (t << 16) | (t << 12) | (t << 8) | (p << 4) | p);
+        }
+    }
+    if (uint32_t top = STRAIGHT_TABLE[all])
+    {
+        return make_strength(Category::Straight, straight_ranks(top));
+    }
+    if (trips)
+    {
+        uint32_t t = top_rank(trips);
+        return make_strength(Category::Three_of_a_Kind,
+            (t << 16) | (t << 12) | (t << 8) | top_ranks(all & ~rank_bit(t), 2));
+    }
+    if (std::popcount(pairs) >= 2)
+    {
+        // Potentially three pairs, so choose the two highest-ranked pairs
+        uint32_t high = top_rank(pairs);
+        uint32_t low = top_rank(pairs & ~rank_bit(high));
+        uint32_t kicker = top_ranks(all & ~rank_bit(high) & ~rank_bit(low), 1);
+        return make_strength(Category::Two_Pair,
+            (high << 16) | (high << 12) | (low << 8) | (low << 4) | kicker);
+    }
+    if (pairs)
+    {
+        uint32_t p = top_rank(pairs);
+        return make_strength(Category::Pair,
+            (p << 16) | (p << 12) | top_ranks(all & ~rank_bit(p), 3));
+    }
+    return make_strength(Category::High_Card, TOP_FIVE_TABLE[all]);
+}
+
+HandStrength evaluate_hand(const vector<Card>& cards)
+{
+    CardMask mask;
+    for (const auto& c : cards)
+    {
+        mask.add_card(c);
+    }
+    return evaluate_hand(mask);
+}
+
+void evaluate_hands(
+    const CardMask& board,
+    const CardMask* hole_cards,
+    size_t num_hands,
+    uint32_t* keys)
+{
+    /**
+     * Determine the strength keys of many hands that share the same board.
+     *
+     * Uses AVX2 if the processor supports it and falls back on evaluating
+     * one hand at a time otherwise.  The keys are identical either way.
+     *
+     * @param board contains the community cards.
+     * @param hole_cards are num_hands masks of each player's hole cards, each
+     *        making a hand of at most seven cards with the board.
+     * @param num_hands is the number of hands to evaluate.
+     * @param keys is storage for num_hands strength keys.
+    */
+#if defined(__x86_64__) || defined(__i386__)
+    if (USE_SIMD_EVALUATOR && cpu_supports_avx2())
+    {
+        evaluate_hands_avx2(board, hole_cards, num_hands, keys);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < num_hands; i++)
+    {
+        CardMask mask = board;
+        for (int s = 0; s < NUMBER_SUITS; s++)
+        {
+            mask.suit_ranks[s] |= hole_cards[i].suit_ranks[s];
+        }
+        keys[i] = evaluate_hand(mask).key;
+    }
+}
+
+vector<uint32_t> evaluate_hands(
+    const vector<Card>& board,
+    const vector<std::pair<Card, Card>>& hole_cards)
+{
+    /**
+     * Return the strength key of every player's hole cards with the board.
+    */
+    CardMask board_mask;
+    for (const auto& c : board)
+    {
+        board_mask.add_card(c);
+    }
+    vector<CardMask> hole_masks(hole_cards.size());
+    for (size_t i = 0; i < hole_cards.size(); i++)
+    {
+        hole_masks[i].add_card(hole_cards[i].first);
+        hole_masks[i].add_card(hole_cards[i].second);
+    }
+    vector<uint32_t> keys(hole_cards.size());
+    evaluate_hands(board_mask, hole_masks.data(), hole_masks.size(), keys.data());
+    return keys;
+}
+
+uint32_t hand_strength_key(const array<Card, MAX_CARDS_IN_HAND>& best_hand)
+{
+    /**
+     * Return the strength key of a player's best five card hand.
+    */
+    CardMask mask;
+    for (const auto& c : best_hand)
+    {
+        mask.add_card(c);
+    }
+    return evaluate_hand(mask).key;
+}
+
+array<Card, MAX_CARDS_IN_HAND> select_best_hand(
+    std::span<const Card> cards,
+    const HandStrength& strength)
+{
+    /**
+     * Choose the cards that make up the best hand described by strength.
+     *
+     * Cards of equal rank are chosen in the order they appear, and the hand
+     * is returned in ascending order of rank except for a wheel, where the
+     * last ace leads.  This matches the best hand recorded by the original
+     * evaluator.
+     *
+     * @param cards are the available cards in the order they were dealt, or
+     *        stably sorted by rank.
+     * @param strength is the result of evaluate_hand() for the same cards.
+     * @return The best five card hand, padded with blank cards if fewer than
+     *         five cards are available.
+    */
+    array<int, to_underlying(Rank::Ace) + 1> needed{};
+    for (int i = 0; i < MAX_CARDS_IN_HAND; i++)
+    {
+        uint32_t rank = (strength.key >> (4 * i)) & 0xF;
+        if (rank == 1) { rank = to_underlying(Rank::Ace); }  // Wheel ace
+        if (rank != 0) { needed[rank]++; }
+    }
+    int flush_suit = -1;
+    if (strength.hand_rank == HandRank::Flush ||
+        strength.hand_rank == HandRank::Wheel_Straight_Flush ||
+        strength.hand_rank == HandRank::Straight_Flush ||
+        strength.hand_rank == HandRank::Royal_Flush)
+    {
+        array<int, NUMBER_SUITS> suit_count{};
+        for (const auto& c : cards)
+        {
+            if (++suit_count[suit_index(c.suit)] == MAX_CARDS_IN_HAND)
+            {
+                flush_suit = suit_index(c.suit);
+                break;
+            }
+        }
+    }
+    array<Card, MAX_CARDS_IN_HAND> best_hand;
+    size_t idx = 0;
+    bool is_wheel = strength.hand_rank == HandRank::Wheel_Straight ||
+        strength.hand_rank == HandRank::Wheel_Straight_Flush;
+    if (is_wheel)
+    {
+        // The last ace leads a wheel
+        needed[to_underlying(Rank::Ace)] = 0;
+        for (auto it = cards.rbegin(); it != cards.rend(); it++)
+        {
+            if (it->rank == Rank::Ace &&
+                (flush_suit < 0 || suit_index(it->suit) == flush_suit))
+            {
+                best_hand[idx++] = *it;
+                break;
+            }
+        }
+    }
+    for (int rank = 0; rank < static_cast<int>(needed.size()); rank++)
+    {
+        for (const auto& c : cards)
+        {
+            if (needed[rank] == 0) { break; }
+            if (to_underlying(c.rank) == rank &&
+                (flush_suit < 0 || suit_index(c.suit) == flush_suit))
+            {
+                needed[rank]--;
+                best_hand[idx++] = c;
+            }
+        }
+    }
+    return best_hand;
+}
+
+int suit_index(Suit suit)
+{
+    /**
+     * Return the index of the suit in Card_Suits, or -1 for No_Card.
+    */
+    switch (suit)
+    {
+    case Suit::Diamond:
+        return 0;
+    case Suit::Heart:
+        return 1;
+    case Suit::Spade:
+        return 2;
+    case Suit::Club:
+        return 3;
+    default:
+        return -1;
+    }
+}
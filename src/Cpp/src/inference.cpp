@@ -0,0 +1,452 @@
+/******************************************************************************
+* Define a broker that batches neural network inference across tables.
+******************************************************************************/
+
+/* Headers
+******************************************************************************/
+// C++ standard library
+#include <algorithm>    // For std::copy(), std::max(), std::min()
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <future>       // For promise, shared_future
+#include <iostream>
+#include <memory>       // For make_shared
+#include <mutex>
+#include <span>
+#include <stdexcept>    // For invalid_argument, runtime_error
+#include <string>
+#include <thread>
+#include <vector>
+// Project headers
+#include "batch_simulator.hpp"
+#include "constants.hpp"
+#include "inference.hpp"
+#include "serialize.hpp"
+#include "storage.hpp"
+#include <torch/script.h> // One-stop header.
+// Using statements
+using std::string;
+using std::vector;
+using namespace constants;
+
+/* InferenceBroker Method Definitions
+******************************************************************************/
+InferenceBroker::InferenceBroker(
+    torch::jit::script::Module module,
+    size_t max_batch_size,
+    std::chrono::microseconds max_wait) :
+    m_module(module),
+    m_max_batch_size(std::max<size_t>(max_batch_size, 1)),
+    m_max_wait(max_wait),
+    m_worker(&InferenceBroker::m_serve, this) {}
+
+InferenceBroker::~InferenceBroker()
+{
+    {
+        std::lock_guard<std::mutex> lck(m_mutex);
+        m_stop = true;
+    }
+    m_request_cv.notify_all();
+    m_worker.join();
+}
+
+void InferenceBroker::add_caller()
+{
+    /**
+     * Register the calling thread as one that may call infer().
+     *
+     * A thread may register more than once, e.g. once per player it runs,
+     * and counts as one caller until every registration is removed.
+    */
+    std::lock_guard<std::mutex> lck(m_mutex);
+    m_callers[std::this_thread::get_id()]++;
+}
+
+InferenceResult InferenceBroker::infer(const GameState& gs)
+{
+    /**
+     * Queue one decision for the next batch and wait for its result.
+     *
+     * @param gs is the game state of the player to act.  It is read by the
+     * worker thread, so it must not change until infer() returns.
+     * @return The action logits and bet fraction predicted by the model.
+    */
+    Request request;
+    request.state = &gs;
+    std::unique_lock<std::mutex> lck(m_mutex);
+    if (m_pending.empty())
+    {
+        m_oldest_request = std::chrono::steady_clock::now();
+    }
+    m_pending.push_back(&request);
+    m_request_cv.notify_one();
+    m_result_cv.wait(lck, [&request] { return request.done; });
+    if (request.error)
+    {
+        std::rethrow_exception(request.error);
+    }
+    return request.result;
+}
+
+vector<InferenceResult> InferenceBroker::infer(const vector<GameState>& states)
+{
+    /**
+     * Run one forward pass over a whole batch of decisions.
+     *
+     * The batch is run on the calling thread, without waiting for other
+     * callers, for callers such as BatchSimulator that gather their own
+     * batches.
+     *
+     * @param states are the game states of the players to act.
+     * @return The results of each state, in the same order.
+    */
+    vector<Request> requests(states.size());
+    vector<Request*> batch;
+    for (size_t i = 0; i < states.size(); i++)
+    {
+        requests[i].state = &states[i];
+        batch.push_back(&requests[i]);
+    }
+    if (!batch.empty())
+    {
+        m_run_batch(batch);
+        std::lock_guard<std::mutex> lck(m_mutex);
+        m_num_batches++;
+    }
+    vector<InferenceResult> results;
+    for (const auto& request : requests)
+    {
+        results.push_back(request.result);
+    }
+    return results;
+}
+
+size_t InferenceBroker::num_batches() const
+{
+    /**
+     * Return the number of forward passes run so far.
+    */
+    std::lock_guard<std::mutex> lck(m_mutex);
+    return m_num_batches;
+}
+
+void InferenceBroker::remove_caller(std::thread::id caller)
+{
+    /**
+     * Remove one registration made by add_caller() on thread caller.
+    */
+    {
+        std::lock_guard<std::mutex> lck(m_mutex);
+        auto registration = m_callers.find(caller);
+        if (registration == m_callers.end()) { return; }
+        if (--registration->second == 0)
+        {
+            m_callers.erase(registration);
+        }
+    }
+    // The remaining callers may all be waiting already
+    m_request_cv.notify_one();
+}
+
+/* Private InferenceBroker Method Definitions
+******************************************************************************/
+bool InferenceBroker::m_is_batch_full() const
+{
+    /**
+     * Return true if no more requests can join the pending batch.
+     *
+     * Must be called with the mutex held.
+    */
+    size_t batch_size = m_max_batch_size;
+    if (!m_callers.empty())
+    {
+        batch_size = std::min(batch_size, m_callers.size());
+    }
+    return m_pending.size() >= batch_size;
+}
+
+void InferenceBroker::m_run_batch(vector<Request*>& batch)
+{
+    /**
+     * Run one forward pass over a batch of requests and store the results.
+     *
+     * @throws std::runtime_error if the model fails to run.
+    */
+    const int64_t batch_size = static_cast<int64_t>(batch.size());
+    torch::NoGradGuard no_grad;
+    torch::Tensor input = torch::empty(
+        { batch_size, NN_INPUT_SIZE }, torch::dtype(torch::kFloat32));
+    float* input_data = input.data_ptr<float>();
+    for (size_t i = 0; i < batch.size(); i++)
+    {
+        encode_nn_inputs(*batch[i]->state, input_data + i * NN_INPUT_SIZE);
+    }
+    std::vector<torch::jit::IValue> inputs;
+    inputs.push_back(input);
+    at::Tensor actions;
+    at::Tensor bets;
+    try {
+        auto output = m_module.forward(inputs).toTuple();
+        actions =
+            output->elements()[0].toTensor().to(torch::kFloat32).contiguous();
+        bets =
+            output->elements()[1].toTensor().to(torch::kFloat32).contiguous();
+    }
+    catch (const c10::Error& e) {
+        // Callers only see standard exceptions
+        throw std::runtime_error(string("Model inference failed: ") + e.what());
+    }
+    const float* action_data = actions.data_ptr<float>();
+    const float* bet_data = bets.data_ptr<float>();
+    for (size_t i = 0; i < batch.size(); i++)
+    {
+        std::copy(action_data + i * LEGAL_ACTION_COUNT,
+            action_data + (i + 1) * LEGAL_ACTION_COUNT,
+            batch[i]->result.action_logits.begin());
+        batch[i]->result.bet = bet_data[i];
+    }
+}
+
+void InferenceBroker::m_serve()
+{
+    /**
+     * Worker thread that gathers pending requests into batches.
+    */
+    vector<Request*> batch;
+    std::unique_lock<std::mutex> lck(m_mutex);
+    while (true)
+    {
+        m_request_cv.wait(lck, [this] { return m_stop || !m_pending.empty(); });
+        if (m_stop && m_pending.empty()) { return; }
+        // Wait for a full batch, but not longer than max_wait
+        m_request_cv.wait_until(lck, m_oldest_request + m_max_wait,
+            [this] { return m_stop || m_is_batch_full(); });
+        size_t batch_size = std::min(m_pending.size(), m_max_batch_size);
+        batch.assign(m_pending.begin(), m_pending.begin() + batch_size);
+        m_pending.erase(m_pending.begin(), m_pending.begin() + batch_size);
+        lck.unlock();
+        std::exception_ptr error;
+        try
+        {
+            m_run_batch(batch);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+        lck.lock();
+        m_num_batches++;
+        for (auto& request : batch)
+        {
+            request->error = error;
+            request->done = true;
+        }
+        m_result_cv.notify_all();
+    }
+}
+
+/* ModelRegistry Method Definitions
+******************************************************************************/
+void ModelRegistry::add(const string& name, const string& path)
+{
+    /**
+     * Register a model name without loading the model.
+     *
+     * @param name is the name players use to request the model.
+     * @param path is the path of the TorchScript file.
+    */
+    std::lock_guard<std::mutex> lck(m_mutex);
+    m_paths[name] = path;
+}
+
+std::shared_ptr<InferenceBroker> ModelRegistry::get(const string& name)
+{
+    /**
+     * Return the inference broker of a model, loading it on first use.
+     *
+     * The model file is loaded without holding the registry lock, so other
+     * models can be requested meanwhile.  Threads that request the same
+     * model while it is loading wait for the first load to finish.  A load
+     * that fails is not cached, so a later call tries again.
+     *
+     * @param name is a name registered with add().
+     * @return The broker shared by every user of the model file.
+     * @throws std::invalid_argument if name is not registered.
+     * @throws std::runtime_error if the model file cannot be loaded.
+    */
+    string path;
+    std::shared_future<std::shared_ptr<InferenceBroker>> broker;
+    std::promise<std::shared_ptr<InferenceBroker>> loaded_broker;
+    bool is_loader = false;
+    {
+        std::lock_guard<std::mutex> lck(m_mutex);
+        auto registered_path = m_paths.find(name);
+        if (registered_path == m_paths.end())
+        {
+            throw std::invalid_argument("Model " + name + " is not registered!");
+        }
+        path = registered_path->second;
+        Model& model = m_models[path];
+        if (!model.broker.valid())
+        {
+            model.broker = loaded_broker.get_future().share();
+            is_loader = true;
+        }
+        broker = model.broker;
+    }
+    if (is_loader)
+    {
+        m_load(name, path, loaded_broker);
+    }
+    return broker.get();
+}
+
+bool ModelRegistry::is_loaded(const string& name) const
+{
+    /**
+     * Return true if the model has been loaded from its file successfully.
+    */
+    std::lock_guard<std::mutex> lck(m_mutex);
+    auto path = m_paths.find(name);
+    if (path == m_paths.end()) { return false; }
+    auto model = m_models.find(path->second);
+    return model != m_models.end() && model->second.loaded;
+}
+
+double ModelRegistry::load_time_ms(const string& name) const
+{
+    /**
+     * Return how long it took to load the model, or 0 if it isn't loaded.
+    */
+    std::lock_guard<std::mutex> lck(m_mutex);
+    auto path = m_paths.find(name);
+    if (path == m_paths.end()) { return 0; }
+    auto model = m_models.find(path->second);
+    return model == m_models.end() ? 0 : model->second.load_time_ms;
+}
+
+vector<string> ModelRegistry::names() const
+{
+    std::lock_guard<std::mutex> lck(m_mutex);
+    vector<string> names;
+    for (const auto& [name, path] : m_paths)
+    {
+        names.push_back(name);
+    }
+    return names;
+}
+
+/* Private ModelRegistry Method Definitions
+******************************************************************************/
+void ModelRegistry::m_load(
+    const string& name,
+    const string& path,
+    std::promise<std::shared_ptr<InferenceBroker>>& broker)
+{
+    /**
+     * Load a model file and hand its broker to every waiting get() call.
+     *
+     * Must be called without the mutex held.  On any failure the model is
+     * removed from the registry and the error is passed to the callers, so
+     * a later get() tries again.
+    */
+    auto fail = [this, &path, &broker](std::exception_ptr error)
+        {
+            {
+                std::lock_guard<std::mutex> lck(m_mutex);
+                m_models.erase(path);
+            }
+            broker.set_exception(error);
+        };
+    std::shared_ptr<InferenceBroker> loaded_broker;
+    double load_time_ms = 0;
+    try {
+        auto start = std::chrono::steady_clock::now();
+        // Deserialize the ScriptModule from a file using torch::jit::load().
+        torch::jit::script::Module module = torch::jit::load(path);
+        module.eval();
+        load_time_ms = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+        loaded_broker = std::make_shared<InferenceBroker>(module);
+    }
+    catch (const c10::Error& e) {
+        fail(std::make_exception_ptr(std::runtime_error(
+            "Unable to load model " + name + " from " + path + ": " +
+            e.what())));
+        return;
+    }
+    catch (...) {
+        fail(std::current_exception());
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lck(m_mutex);
+        Model& model = m_models[path];
+        model.loaded = true;
+        model.load_time_ms = load_time_ms;
+    }
+    std::cout << "Loaded model " << name << " from " << path << " in " <<
+        load_time_ms << " ms" << std::endl;
+    broker.set_value(loaded_broker);
+}
+
+/* Inference Function Definitions
+******************************************************************************/
+BatchPolicy neural_network_policy(std::shared_ptr<InferenceBroker> broker)
+{
+    /**
+     * Return a BatchSimulator policy that asks a model for every decision.
+     *
+     * The pending tables of each step are encoded into one batch and run in
+     * a single forward pass.  Each table plays the legal action with the
+     * largest logit, and bets and raises push the predicted fraction of the
+     * player's stack, which the simulator clamps to a legal amount.
+     *
+     * @param broker runs the model.
+    */
+    return [broker](const BatchSimulator& sim, std::span<const int> tables,
+        std::span<BatchAction> actions)
+        {
+            vector<GameState> states;
+            for (const int table : tables)
+            {
+                states.push_back(sim.game_state(table));
+            }
+            vector<InferenceResult> results = broker->infer(states);
+            for (size_t i = 0; i < tables.size(); i++)
+            {
+                const std::uint8_t legal = sim.legal_actions(tables[i]);
+                int best = -1;
+                for (int a = 0; a < LEGAL_ACTION_COUNT; a++)
+                {
+                    if (((legal >> a) & 1) && (best < 0 ||
+                        results[i].action_logits[a] >
+                        results[i].action_logits[best]))
+                    {
+                        best = a;
+                    }
+                }
+                if (best < 0) { continue; }
+                actions[i].action = Legal_Actions[best];
+                actions[i].chips = static_cast<unsigned>(std::max(0.0,
+                    static_cast<double>(results[i].bet) *
+                    sim.stack(tables[i], sim.player_to_act(tables[i]))));
+            }
+        };
+}
+
+ModelRegistry& model_registry()
+{
+    /**
+     * Return the process-wide model registry.
+     *
+     * The trained poker model is registered as NN_MODEL_NAME.
+    */
+    static ModelRegistry registry;
+    static std::once_flag registered;
+    std::call_once(registered,
+        [] { registry.add(NN_MODEL_NAME, NN_MODEL_PATH); });
+    return registry;
+}
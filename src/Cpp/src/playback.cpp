@@ -6,13 +6,16 @@
 ******************************************************************************/
 // C++ standard library
 #include <deque>
+#include <fstream>
 #include <iostream>
+#include <stdexcept>    // For std::runtime_error
 #include <string>
 #include <vector>
 // Project headers
 #include "constants.hpp"
 #include "cards.hpp"
 #include "playback.hpp"
+#include "serialize.hpp"
 #include "storage.hpp"
 #include "tabulate/tabulate.hpp"
 // Using statements
@@ -515,7 +518,8 @@ void print_console_output(const GameState& gs)
      * Print console messages describing the poker game.
     */
     static std::deque<string> console_output(MAX_CONSOLE_LINES, "");
-    static vector<int> remaining_players(gs.initial_num_players, true);
+    static FixedVector<int, MAX_PLAYER_COUNT> remaining_players(
+        static_cast<size_t>(gs.initial_num_players), true);
     static Round rnd = Round::Pre_Flop;
     string output;
     if (gs.game_number == 0 && gs.action_number == 0)
@@ -644,18 +648,64 @@ void print_state(const GameState& gs)
     print_console_output(gs);
 }
 
-void playback_tournament(TournamentHistory& th)
+void playback_game(const GameHistory& game)
 {
     /**
-     * Play back the entire poker tournament to terminal one state at a time.
+     * Play back one game to terminal one state at a time.
     */
-    for (const auto& game : th.games)
+    for (const auto& state : game.states)
     {
-        for (const auto& state : game.states)
-        {
-            print_state(state);
-            cout << "\nPress enter to continue: ";
-            std::cin.get();
-        }
+        print_state(state);
+        cout << "\nPress enter to continue: ";
+        std::cin.get();
+    }
+}
+
+void playback_tournament(TournamentHistory& th, size_t start_game)
+{
+    /**
+     * Play back the poker tournament to terminal one state at a time.
+     *
+     * @param th is the tournament history.
+     * @param start_game is the index of the first game to play back.
+    */
+    for (size_t i = start_game; i < th.games.size(); i++)
+    {
+        playback_game(th.games[i]);
+    }
+}
+
+void playback_tournament(string filename, size_t start_game)
+{
+    /**
+     * Play back a recorded tournament file starting from any game.
+     *
+     * The file is opened and its game index read once.  Games are then read
+     * one at a time as they are played back, and games before start_game
+     * are never read.  Files in the original format have no index and are
+     * read in full.
+     *
+     * @param filename is the path of the tournament file.
+     * @param start_game is the index of the first game to play back.
+     * @throws std::runtime_error if the file can't be read.
+    */
+    std::ifstream fs(filename, std::ios::in | std::ios::binary);
+    if (!fs.is_open())
+    {
+        throw std::runtime_error("Failed to open " + filename);
+    }
+    TournamentFileHeader header;
+    if (!read_tournament_file_header(fs, header))
+    {
+        fs.close();
+        TournamentHistory th = read_tournamenthistory(filename);
+        playback_tournament(th, start_game);
+        return;
+    }
+    vector<GameIndexEntry> index = read_game_index(fs, header);
+    for (size_t i = start_game; i < index.size(); i++)
+    {
+        fs.seekg(static_cast<std::streamoff>(index[i].offset));
+        playback_game(read_game_record(fs));
     }
 }
\ No newline at end of file
@@ -6,23 +6,31 @@
 ******************************************************************************/
 // C++ standard library
 #include <array>
-#include <algorithm>    // For std::find()
+#include <algorithm>    // For std::clamp(), std::find(), std::max_element()
 #include <cassert>
+#include <cstdint>
 #include <iostream>
-#include <memory>       // For static_pointer_cast
+#include <memory>       // For make_shared, static_pointer_cast
 #include <random>       // For shuffle(), uniform_int_distribution<>
+#include <span>
+#include <thread>       // For this_thread::get_id()
 #include <utility>      // For std::pair, std::to_underlying()
 // Project headers
 #include "constants.hpp"
+#include "equity.hpp"
+#include "evaluator.hpp"
+#include "inference.hpp"
 #include "player.hpp"
+#include "preflop.hpp"
 #include "serialize.hpp"
 #include "storage.hpp"
-#include "texasholdem.hpp"
+#include "thread_pool.hpp"
 #include <torch/script.h> // One-stop header.
 // Using statements
 using std::array;
 using std::cout;
 using std::endl;
+using std::make_shared;
 using std::pair;
 using std::static_pointer_cast;
 using std::to_underlying;
@@ -655,10 +663,18 @@ Position HeuristicAI::assess_hole_cards(GameState& gs)
      *
      * Return whether the cards are playable in the early position (strongest
      * hands), mid position, late position (weakest hands), or if the cards are
-     * unplayable.
+     * unplayable.  If the preflop equity table has been generated, the
+     * numeric equity of the hole cards is also stored in hole_card_equity.
     */
     Card hole_card1 = gs.hole_cards[gs.player_idx].first;
     Card hole_card2 = gs.hole_cards[gs.player_idx].second;
+    const PreflopEquityTable& preflop_table = preflop_equity_table();
+    if (preflop_table.is_loaded())
+    {
+        int table_size = std::clamp(
+            gs.num_active_players, MIN_PLAYER_COUNT, MAX_PLAYER_COUNT);
+        hole_card_equity = preflop_table.equity(hole_card1, hole_card2, table_size);
+    }
     HoleCards cards_suit = HoleCards::Unsuited;
     if (hole_card1.suit == hole_card2.suit)
     {
@@ -821,24 +837,42 @@ double HeuristicAI::run_mc_sim(int sim_num_players, GameState& gs, int num_runs)
 {
     /**
      * Run Monte Carlo simulation to determine player's probability of winning.
+     *
+     * The remaining community cards and the opponents' hole cards are dealt
+     * directly by the equity calculator rather than playing out each run as
+     * a game of Texas Hold 'Em.  Flop equities are shared through
+     * flop_equity_cache().  If set_equity_threads() has enabled it, the runs
+     * are split across threads without changing the result.
+     *
+     * @param sim_num_players is the number of players including this player.
+     * @param gs is the current game state.
+     * @param num_runs is the number of simulated deals.
+     * @return The player's equity, where split pots count fractionally.
     */
-    vector<AI_Type> player_ai_types;
-    for (int i = 0; i < sim_num_players; i++)
+    vector<Card> starting_hand = create_starting_hand(gs);
+    pair<Card, Card> hole_cards = gs.hole_cards[gs.player_idx];
+    vector<Card> board(starting_hand.begin() + 2, starting_hand.end());
+    int num_opponents = sim_num_players - 1;
+    if (gs.round == Round::Flop && num_runs < (1 << 18))
     {
-        player_ai_types.push_back(constants::AI_Type::CheckCall);
+        // Suit-isomorphic flops have the same equity, so look it up in the
+        // cache.  Seeding from the cards keeps cached values reproducible
+        // regardless of which tournament thread computed them first.
+        canonicalize_suits(hole_cards, board);
+        std::uint64_t key = equity_cache_key(
+            hole_cards, board, num_opponents, num_runs);
+        double equity;
+        if (flop_equity_cache().lookup(key, equity)) { return equity; }
+        equity = calculate_equity(hole_cards, board, num_opponents, num_runs,
+            StreamRng(key), equity_thread_pool()).equity();
+        flop_equity_cache().insert(key, equity);
+        return equity;
     }
-    TexasHoldEm the(
-        player_ai_types,
-        sim_num_players,
-        gs.random_seed,
-        0,
-        false
-    );
-    vector<Card> starting_hand = create_starting_hand(gs);
-    the.begin_mc_game(starting_hand, num_runs);
-    double win_perc = static_cast<double>(the.mc_run_wins) /
-        static_cast<double>(the.mc_total_runs);
-    return win_perc;
+    // Every decision samples its own deals
+    StreamRng mc_rng(gs.random_seed, RngStream::Rollout, gs.tournament_number,
+        gs.game_number, gs.action_number, gs.player_idx);
+    return calculate_equity(hole_cards, board, num_opponents, num_runs,
+        mc_rng, equity_thread_pool()).equity();
 }
 
 vector<Card> HeuristicAI::create_starting_hand(GameState& gs)
@@ -896,6 +930,22 @@ unsigned HeuristicAI::round_bet(double bet)
 
 /* NeuralNetworkAI Method Definitions
 ******************************************************************************/
+NeuralNetworkAI::NeuralNetworkAI(
+    const StreamRng& rng,
+    const std::string& model_name) :
+    PlayerAI(rng),
+    m_broker(model_registry().get(model_name)),
+    m_caller_thread(std::this_thread::get_id())
+{
+    // The player acts on the thread that runs its tournament
+    m_broker->add_caller();
+}
+
+NeuralNetworkAI::~NeuralNetworkAI()
+{
+    m_broker->remove_caller(m_caller_thread);
+}
+
 void NeuralNetworkAI::player_act(GameState& gs)
 {
     /**
@@ -904,26 +954,20 @@ void NeuralNetworkAI::player_act(GameState& gs)
      * @param gs is the current game state.
      * @return Modifies the game state with the chosen action and bet amount.
     */
-    // Convert game state to a vector of doubles
-    vector<double> nn_vector = game_state_to_nn_vector(gs);
-    // Remove 8 output states and only leave input states (60 inputs)
-    nn_vector.resize(NN_INPUT_SIZE);
-    // Convert vector game state to a tensor and make a model inference
-    std::vector<torch::jit::IValue> inputs;
-    inputs.push_back(torch::tensor(nn_vector).unsqueeze(0));
-    auto output = module.forward(inputs).toTuple();
+    // Batched with the decisions of every other player using the model
+    InferenceResult output = m_broker->infer(gs);
     // Parse the model output
-    at::Tensor actions = output->elements()[0].toTensor();
-    at::Tensor bet = output->elements()[1].toTensor();
-    double min_action_logit = at::min(actions).item<double>();
+    array<float, LEGAL_ACTION_COUNT>& actions = output.action_logits;
+    float min_action_logit = *std::min_element(actions.begin(), actions.end());
     for (int i = 0; i < LEGAL_ACTION_COUNT; i++)
     {
         if (!legal_act(Legal_Actions[i], gs))
         {
-            actions[0][i] = min_action_logit - 1;
+            actions[i] = min_action_logit - 1;
         }
     }
-    int model_action_idx = at::argmax(actions).item<int>();
+    auto model_action_idx =
+        std::max_element(actions.begin(), actions.end()) - actions.begin();
     Action model_action = Legal_Actions[model_action_idx];
     assert(legal_act(model_action, gs) &&
         "Neural Network chose illegal action!");
@@ -942,7 +986,7 @@ void NeuralNetworkAI::player_act(GameState& gs)
     }
     else
     {
-        model_bet = round_bet(bet.item<double>() * gs.max_bet);
+        model_bet = round_bet(static_cast<double>(output.bet) * gs.max_bet);
         if (model_bet < gs.chips_to_call + gs.min_to_raise)
         {
             if (gs.chips_to_call + gs.min_to_raise < gs.max_bet)
@@ -985,28 +1029,47 @@ void Player::eliminate_player()
     m_active = false;
 }
 
-void Player::fold_player()
+void Player::fold_player(const Board& board)
 {
     /**
      * Folder player's hand.
+     *
+     * The player's hand is no longer improved by community cards dealt after
+     * they folded.
     */
     m_active = false;
+    m_board_cards_seen = board.size();
 }
 
-vector<Card> Player::get_available_cards()
+vector<Card> Player::get_available_cards(const Board& board) const
 {
-    return m_hand.available_cards;
+    /**
+     * Return the player's hole cards and visible community cards.
+     *
+     * The cards are sorted by ascending rank, with cards of equal rank in the
+     * order they were dealt.
+    */
+    vector<Card> cards;
+    if (m_num_hole_cards > 0) { cards.push_back(m_hole_cards.first); }
+    if (m_num_hole_cards > 1) { cards.push_back(m_hole_cards.second); }
+    for (size_t i = 0; i < m_visible_board_cards(board); i++)
+    {
+        cards.push_back(board[i]);
+    }
+    std::stable_sort(cards.begin(), cards.end(), Hand::card_sorter);
+    return cards;
 }
 
-array<Card, MAX_CARDS_IN_HAND> Player::get_best_hand()
+array<Card, MAX_CARDS_IN_HAND> Player::get_best_hand(const Board& board)
 {
-    m_hand.determine_best_hand();
-    return m_hand.best_hand;
+    m_evaluate_hand(board);
+    return m_best_hand;
 }
 
-HandRank Player::get_best_hand_rank()
+HandRank Player::get_best_hand_rank(const Board& board)
 {
-    return m_hand.hand_rank;
+    m_evaluate_hand(board);
+    return m_hand_rank;
 }
 
 Blind Player::get_blind_status() const
@@ -1016,12 +1079,12 @@ Blind Player::get_blind_status() const
 
 std::pair<Card, Card> Player::get_hole_cards()
 {
-    return std::make_pair(m_hand.hole_card1, m_hand.hole_card2);
+    return m_hole_cards;
 }
 
-size_t Player::get_card_count() const
+size_t Player::get_card_count(const Board& board) const
 {
-    return m_hand.available_cards.size();
+    return m_num_hole_cards + m_visible_board_cards(board);
 }
 
 unsigned Player::get_chip_count() const
@@ -1062,12 +1125,33 @@ void Player::receive_card(const Card& c)
     /**
      * Receive hole card from dealer.
     */
-    m_hand.add_card(c);
+    assert((m_num_hole_cards < 2) && "Player already has two hole cards!");
+    if (m_num_hole_cards == 0)
+    {
+        m_hole_cards.first = c;
+    }
+    else
+    {
+        m_hole_cards.second = c;
+    }
+    m_num_hole_cards++;
+    m_is_evaluated = false;
 }
 
 void Player::return_cards()
 {
-    m_hand.clear_hand();
+    m_hole_cards = std::make_pair(Card(), Card());
+    m_num_hole_cards = 0;
+    m_board_cards_seen = MAX_CARDS_IN_HAND;
+    m_is_evaluated = false;
+}
+
+void Player::seed_ai(const StreamRng& rng)
+{
+    /**
+     * Give the player's AI the random number stream of its next action.
+    */
+    m_ai->rng = rng;
 }
 
 void Player::set_player_active()
@@ -1092,6 +1176,58 @@ void Player::pass_script(vector<pair<Action, unsigned>> script)
 
 /* Private Player Method Definitions
 ************************************/
+void Player::m_evaluate_hand(const Board& board)
+{
+    /**
+     * Determine the player's best hand, unless it is already up to date.
+     *
+     * The hole cards are combined with the shared board on demand, so the
+     * hand only needs to be evaluated again once more of the board is
+     * visible to the player.
+    */
+    size_t board_cards = m_visible_board_cards(board);
+    if (m_is_evaluated && m_evaluated_cards == board_cards) { return; }
+    if constexpr (USE_LOOKUP_EVALUATOR)
+    {
+        // Keep the cards in the order they were dealt, which is the order
+        // select_best_hand() breaks ties between cards of equal rank
+        array<Card, 2 + MAX_CARDS_IN_HAND> cards;
+        size_t num_cards = 0;
+        CardMask mask = board.card_mask(board_cards);
+        if (m_num_hole_cards > 0)
+        {
+            mask.add_card(m_hole_cards.first);
+            cards[num_cards++] = m_hole_cards.first;
+        }
+        if (m_num_hole_cards > 1)
+        {
+            mask.add_card(m_hole_cards.second);
+            cards[num_cards++] = m_hole_cards.second;
+        }
+        for (size_t i = 0; i < board_cards; i++)
+        {
+            cards[num_cards++] = board[i];
+        }
+        HandStrength strength = evaluate_hand(mask);
+        m_hand_rank = strength.hand_rank;
+        m_best_hand = select_best_hand(
+            std::span<const Card>(cards.data(), num_cards), strength);
+    }
+    else
+    {
+        Hand hand;
+        for (const auto& c : get_available_cards(board))
+        {
+            hand.add_card(c);
+        }
+        hand.determine_best_hand();
+        m_hand_rank = hand.hand_rank;
+        m_best_hand = hand.best_hand;
+    }
+    m_is_evaluated = true;
+    m_evaluated_cards = board_cards;
+}
+
 unsigned Player::m_push_chips_to_pot(unsigned chips)
 {
     /**
@@ -1112,7 +1248,7 @@ unsigned Player::m_push_chips_to_pot(unsigned chips)
     return temp;
 }
 
-void Player::m_select_ai(std::mt19937& rng)
+void Player::m_select_ai(const StreamRng& rng)
 {
     /**
      * Select the appropriate act method based on the player's AI type.
@@ -1145,3 +1281,15 @@ void Player::m_select_ai(std::mt19937& rng)
         exit(-1);
     }
 }
+
+size_t Player::m_visible_board_cards(const Board& board) const
+{
+    /**
+     * Return how many community cards count towards the player's hand.
+     *
+     * Players without hole cards have no hand, and players who folded only
+     * saw the cards dealt before they folded.
+    */
+    if (m_num_hole_cards == 0) { return 0; }
+    return std::min(board.size(), m_board_cards_seen);
+}
@@ -120,12 +120,7 @@ void Dealer::burn_one_card()
 
 void Dealer::clear_cards_from_table()
 {
-    flop_card1 = Card();
-    flop_card2 = Card();
-    flop_card3 = Card();
-    turn_card = Card();
-    river_card = Card();
-
+    board.clear();
 }
 
 Card Dealer::deal_one_card()
@@ -133,9 +128,13 @@ Card Dealer::deal_one_card()
     return m_deck.deal_one_card();
 }
 
-void Dealer::shuffle_deck()
+void Dealer::shuffle_deck(const StreamRng& rng, DealMode mode)
 {
-    m_deck.shuffle_deck();
+    /**
+     * Shuffle the deck with the random number stream of the current game.
+    */
+    m_deck.rng = rng;
+    m_deck.shuffle_deck(mode);
 }
 
 void Dealer::deal_to_players(
@@ -166,71 +165,42 @@ void Dealer::deal_to_players(
     }
 }
 
-void Dealer::deal_flop(vector<Player>& player_list)
+void Dealer::deal_flop()
 {
     /**
      * Deal the flop - three community cards.
      *
-     * The dealer must burn a card before dealing the flop.  Each player who
-     * remains in the tournament receives a copy of the flop cards so that
-     * they can assemble their best poker hand.
+     * The dealer must burn a card before dealing the flop.  The flop is
+     * placed on the shared board, where every player who remains in the hand
+     * can use it to assemble their best poker hand.
     */
     burn_one_card();
-    flop_card1 = deal_one_card();
-    flop_card2 = deal_one_card();
-    flop_card3 = deal_one_card();
-    for (auto& player : player_list)
+    for (int i = 0; i < 3; i++)
     {
-        if (!player.is_player_eliminated() &&
-            player.is_player_active())
-        {
-            player.receive_card(flop_card1);
-            player.receive_card(flop_card2);
-            player.receive_card(flop_card3);
-        }
+        board.add_card(deal_one_card());
     }
 }
 
-void Dealer::deal_turn(vector<Player>& player_list)
+void Dealer::deal_turn()
 {
     /**
      * Deal the turn - one community card.
      *
-     * The dealer must burn a card before dealing the turn.  Each player who
-     * remains in the tournament receives a copy of the turn card so that
-     * they can assemble their best poker hand.
+     * The dealer must burn a card before dealing the turn.
     */
     burn_one_card();
-    turn_card = deal_one_card();
-    for (auto& player : player_list)
-    {
-        if (!player.is_player_eliminated() &&
-            player.is_player_active())
-        {
-            player.receive_card(turn_card);
-        }
-    }
+    board.add_card(deal_one_card());
 }
 
-void Dealer::deal_river(vector<Player>& player_list)
+void Dealer::deal_river()
 {
     /**
      * Deal the river - one community card.
      *
-     * The dealer must burn a card before dealing the river.  Each player who
-     * remains in the tournament receives a copy of the river card so that
-     * they can assemble their best poker hand.
+     * The dealer must burn a card before dealing the river.
     */
     burn_one_card();
-    river_card = deal_one_card();
-    for (auto& player : player_list)
-    {
-        if (!player.is_player_eliminated() &&
-            player.is_player_active())
-        {
-            player.receive_card(river_card);
-        }
-    }
+    board.add_card(deal_one_card());
 }
 
 void Dealer::stack_the_deck(vector<Card> cards)
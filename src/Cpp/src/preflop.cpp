@@ -0,0 +1,255 @@
+/******************************************************************************
+* Define the precomputed preflop equity table.
+*
+* The table is generated offline by simulating every hole card class at every
+* table size, and saved to a versioned binary file.  The file starts with a
+* header (magic, format version, number of classes, minimum and maximum
+* player count, and simulated deals per entry) followed by the float32
+* equities ordered by hole card class and then player count.
+******************************************************************************/
+
+/* Headers
+******************************************************************************/
+// C++ standard library
+#include <algorithm>    // For std::max() and std::min()
+#include <cassert>
+#include <cstdint>
+#include <cstring>      // For std::memcmp()
+#include <fstream>
+#include <iostream>
+#include <random>       // For mt19937 and seed_seq
+#include <string>
+#include <utility>      // For std::pair, std::to_underlying()
+#include <vector>
+// Project headers
+#include "cards.hpp"
+#include "constants.hpp"
+#include "equity.hpp"
+#include "preflop.hpp"
+#include "thread_pool.hpp"
+// Using statements
+using std::endl;
+using std::pair;
+using std::string;
+using std::to_underlying;
+using std::uint32_t;
+using std::vector;
+using namespace constants;
+
+/* Constants and Enums
+******************************************************************************/
+constexpr char PREFLOP_TABLE_MAGIC[4] = { 'D', 'S', 'P', 'E' };
+constexpr int NUM_PLAYER_COUNTS = MAX_PLAYER_COUNT - MIN_PLAYER_COUNT + 1;
+
+/* PreflopEquityTable Method Definitions
+******************************************************************************/
+float PreflopEquityTable::equity(
+    const Card& c1,
+    const Card& c2,
+    int num_players) const
+{
+    return equity(hole_card_class(c1, c2), num_players);
+}
+
+float PreflopEquityTable::equity(int hand_class, int num_players) const
+{
+    /**
+     * Look up the equity of a hole card class at a table of num_players.
+     *
+     * @param hand_class is the index returned by hole_card_class().
+     * @param num_players is the number of players dealt into the hand.
+     * @return The equity of the hole cards against random hands.
+    */
+    assert((hand_class >= 0 && hand_class < NUM_HOLE_CARD_CLASSES) &&
+        "Invalid hole card class!");
+    assert((num_players >= MIN_PLAYER_COUNT && num_players <= MAX_PLAYER_COUNT)
+        && "Number of players must be between 2 and 10!");
+    return m_equity[hand_class * NUM_PLAYER_COUNTS +
+        (num_players - MIN_PLAYER_COUNT)];
+}
+
+bool PreflopEquityTable::is_loaded() const
+{
+    return num_runs > 0;
+}
+
+bool PreflopEquityTable::load(const string& filename)
+{
+    /**
+     * Read the table from a binary file.
+     *
+     * @param filename is the path of a file written by save().
+     * @return False if the file is missing, has a different format version,
+     *         or has a different shape than this table.
+    */
+    std::ifstream fs(filename, std::ios::in | std::ios::binary);
+    if (!fs.is_open()) { return false; }
+    char magic[4];
+    uint32_t version, num_classes, min_players, max_players, runs;
+    fs.read(magic, sizeof magic);
+    fs.read(reinterpret_cast<char*>(&version), sizeof version);
+    fs.read(reinterpret_cast<char*>(&num_classes), sizeof num_classes);
+    fs.read(reinterpret_cast<char*>(&min_players), sizeof min_players);
+    fs.read(reinterpret_cast<char*>(&max_players), sizeof max_players);
+    fs.read(reinterpret_cast<char*>(&runs), sizeof runs);
+    if (!fs ||
+        std::memcmp(magic, PREFLOP_TABLE_MAGIC, sizeof magic) != 0 ||
+        version != PREFLOP_TABLE_VERSION ||
+        num_classes != NUM_HOLE_CARD_CLASSES ||
+        min_players != MIN_PLAYER_COUNT ||
+        max_players != MAX_PLAYER_COUNT)
+    {
+        std::cerr << "Preflop equity table " << filename <<
+            " is not a version " << PREFLOP_TABLE_VERSION << " table" << endl;
+        return false;
+    }
+    fs.read(reinterpret_cast<char*>(&m_equity[0]),
+        sizeof m_equity[0] * m_equity.size());
+    if (!fs) { return false; }
+    num_runs = runs;
+    return true;
+}
+
+bool PreflopEquityTable::save(const string& filename) const
+{
+    /**
+     * Write the table to a binary file.
+     *
+     * @param filename is the path of the file to overwrite.
+     * @return False if the file could not be opened or written.
+    */
+    std::ofstream fs(filename, std::ios::out | std::ios::binary);
+    if (!fs.is_open())
+    {
+        std::cerr << "Failed to open " << filename << endl;
+        return false;
+    }
+    uint32_t version = PREFLOP_TABLE_VERSION;
+    uint32_t num_classes = NUM_HOLE_CARD_CLASSES;
+    uint32_t min_players = MIN_PLAYER_COUNT;
+    uint32_t max_players = MAX_PLAYER_COUNT;
+    uint32_t runs = num_runs;
+    fs.write(PREFLOP_TABLE_MAGIC, sizeof PREFLOP_TABLE_MAGIC);
+    fs.write(reinterpret_cast<char*>(&version), sizeof version);
+    fs.write(reinterpret_cast<char*>(&num_classes), sizeof num_classes);
+    fs.write(reinterpret_cast<char*>(&min_players), sizeof min_players);
+    fs.write(reinterpret_cast<char*>(&max_players), sizeof max_players);
+    fs.write(reinterpret_cast<char*>(&runs), sizeof runs);
+    fs.write(reinterpret_cast<const char*>(&m_equity[0]),
+        sizeof m_equity[0] * m_equity.size());
+    fs.close();
+    if (!fs)
+    {
+        std::cerr << "Failed to write " << filename << endl;
+        return false;
+    }
+    return true;
+}
+
+void PreflopEquityTable::set_equity(int hand_class, int num_players, float equity)
+{
+    assert((hand_class >= 0 && hand_class < NUM_HOLE_CARD_CLASSES) &&
+        "Invalid hole card class!");
+    assert((num_players >= MIN_PLAYER_COUNT && num_players <= MAX_PLAYER_COUNT)
+        && "Number of players must be between 2 and 10!");
+    m_equity[hand_class * NUM_PLAYER_COUNTS +
+        (num_players - MIN_PLAYER_COUNT)] = equity;
+}
+
+/* Preflop Function Definitions
+******************************************************************************/
+int hole_card_class(const Card& c1, const Card& c2)
+{
+    /**
+     * Map two hole cards to one of the 169 hole card classes.
+     *
+     * Classes form a 13 x 13 grid indexed by rank (Two is 0).  Pocket pairs
+     * lie on the diagonal, suited hands have the higher rank as the row, and
+     * unsuited hands have the higher rank as the column.
+    */
+    int rank1 = to_underlying(c1.rank) - to_underlying(Rank::Two);
+    int rank2 = to_underlying(c2.rank) - to_underlying(Rank::Two);
+    int high = std::max(rank1, rank2);
+    int low = std::min(rank1, rank2);
+    if (c1.suit == c2.suit)
+    {
+        return high * NUMBER_CARDS_IN_SUIT + low;
+    }
+    return low * NUMBER_CARDS_IN_SUIT + high;
+}
+
+pair<Card, Card> hole_card_class_example(int hand_class)
+{
+    /**
+     * Return a pair of hole cards that belongs to the hole card class.
+    */
+    int row = hand_class / NUMBER_CARDS_IN_SUIT;
+    int col = hand_class % NUMBER_CARDS_IN_SUIT;
+    if (row > col)
+    {
+        return { Card(Suit::Diamond, Card_Ranks[row]),
+            Card(Suit::Diamond, Card_Ranks[col]) };
+    }
+    return { Card(Suit::Diamond, Card_Ranks[col]),
+        Card(Suit::Heart, Card_Ranks[row]) };
+}
+
+PreflopEquityTable generate_preflop_equity_table(
+    int num_runs,
+    int seed,
+    unsigned num_threads)
+{
+    /**
+     * Simulate the equity of every hole card class at every table size.
+     *
+     * Every entry is a separate task on a thread pool.  Each entry has its
+     * own random number generator seeded from seed and the entry index, so
+     * the table does not depend on the number of threads.
+     *
+     * @param num_runs is the number of simulated deals per table entry.
+     * @param seed is the random seed used to generate the table.
+     * @param num_threads is the number of threads to simulate with.
+     * @return The generated table.
+    */
+    PreflopEquityTable table;
+    table.num_runs = static_cast<unsigned>(num_runs);
+    const int num_entries = NUM_HOLE_CARD_CLASSES * NUM_PLAYER_COUNTS;
+    ThreadPool pool(std::max(num_threads, 1u));
+    for (int entry = 0; entry < num_entries; entry++)
+    {
+        pool.submit([entry, num_runs, seed, &table]
+            {
+                int hand_class = entry / NUM_PLAYER_COUNTS;
+                int num_players = MIN_PLAYER_COUNT + entry % NUM_PLAYER_COUNTS;
+                std::seed_seq seq{ seed, entry };
+                std::mt19937 rng(seq);
+                EquityResult result = sample_equity(
+                    hole_card_class_example(hand_class),
+                    {},
+                    num_players - 1,
+                    num_runs,
+                    rng);
+                table.set_equity(hand_class, num_players,
+                    static_cast<float>(result.equity()));
+            });
+    }
+    pool.wait();
+    return table;
+}
+
+const PreflopEquityTable& preflop_equity_table()
+{
+    /**
+     * Return the process-wide table, loading it on first use.
+     *
+     * If the table file has not been generated, is_loaded() returns false
+     * and every equity is zero.
+    */
+    static const PreflopEquityTable table = []
+        {
+            PreflopEquityTable t;
+            t.load(PREFLOP_TABLE_PATH);
+            return t;
+        }();
+    return table;
+}
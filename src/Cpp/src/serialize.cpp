@@ -6,18 +6,23 @@
 ******************************************************************************/
 // C++ standard library
 #include <algorithm>    // For std::replace()
+#include <cassert>
 #include <chrono>       // For timestamp() function
+#include <cstring>      // For std::memcmp()
 #include <fstream>
 #include <iostream>
 #include <iomanip>      // For put_time() in timestamp() function
 #include <sstream>      // stringstream in timestamp() function
+#include <stdexcept>    // For std::runtime_error()
 #include <string>
 #include <vector>
 // Project headers
 #include "cards.hpp"
 #include "constants.hpp"
+#include "evaluator.hpp"
 #include "serialize.hpp"
 #include "storage.hpp"
+#include "tournament_view.hpp"
 // Using statements
 using std::array;
 using std::cout;
@@ -29,8 +34,10 @@ using std::to_underlying;
 using std::vector;
 using namespace constants;
 
-/* Forward Declarations
+/* Constants and Enums
 ******************************************************************************/
+constexpr char TOURNAMENT_FILE_MAGIC[4] = { 'D', 'S', 'T', 'H' };
+constexpr char GAME_INDEX_MAGIC[4] = { 'D', 'S', 'G', 'I' };
 
 
 /* Serialize/Deserialize Definitions
@@ -51,6 +58,7 @@ ShowdownStruct read_showdownstruct(std::ifstream& fs)
         fs.read(reinterpret_cast<char*>(&sd.hand_rank), sizeof sd.hand_rank);
         fs.read(reinterpret_cast<char*>(&sd.total_chips_bet), sizeof sd.total_chips_bet);
         fs.read(reinterpret_cast<char*>(&sd.chips_won), sizeof sd.chips_won);
+        sd.hand_strength = hand_strength_key(sd.best_hand);
         return sd;
     }
 }
@@ -286,79 +294,641 @@ void write_gamehistory(std::ofstream& fs, GameHistory& gh)
     }
 }
 
-TournamentHistory read_tournamenthistory(string filename, bool summary)
+GameStateRecord encode_game_state(const GameState& gs)
 {
-    TournamentHistory th;
-    std::ifstream fs(filename, std::ios::in | std::ios::binary);
-    if (!fs.is_open())
+    /**
+     * Convert a game state into its fixed-layout file record.
+     *
+     * The record starts zero-filled, so unused vector slots and reserved
+     * bytes are always zero.
+    */
+    GameStateRecord record{};
+    auto byte = [](auto value) { return static_cast<std::uint8_t>(value); };
+    auto card = [](const Card& c) { return static_cast<std::uint8_t>(card_index(c)); };
+    std::copy(gs.win_perc.begin(), gs.win_perc.end(), record.win_perc.begin());
+    record.random_seed = gs.random_seed;
+    record.tournament_number = gs.tournament_number;
+    record.game_number = gs.game_number;
+    record.num_games_per_blind_level = gs.num_games_per_blind_level;
+    record.initial_num_players = gs.initial_num_players;
+    record.num_players = gs.num_players;
+    record.num_active_players = gs.num_active_players;
+    record.action_number = gs.action_number;
+    record.player_idx = gs.player_idx;
+    record.raise_player_idx = gs.raise_player_idx;
+    record.sum_prev_bets = gs.sum_prev_bets;
+    record.pot_chip_count = gs.pot_chip_count;
+    record.chips_to_call = gs.chips_to_call;
+    record.min_bet = gs.min_bet;
+    record.max_bet = gs.max_bet;
+    record.min_to_raise = gs.min_to_raise;
+    record.player_bet = gs.player_bet;
+    for (int i = 0; i < MAX_PLAYER_COUNT; i++)
     {
-        cout << "Failed to open " << filename << endl;
-        exit(-1);
+        std::copy(gs.pot_player_bets[i].begin(), gs.pot_player_bets[i].end(),
+            record.pot_player_bets[i].begin());
     }
-    else
+    std::copy(gs.player_chip_counts.begin(), gs.player_chip_counts.end(),
+        record.player_chip_counts.begin());
+    std::copy(gs.remaining_players.begin(), gs.remaining_players.end(),
+        record.remaining_players.begin());
+    std::copy(gs.active_player_list.begin(), gs.active_player_list.end(),
+        record.active_player_list.begin());
+    for (size_t i = 0; i < gs.showdown_players.size(); i++)
+    {
+        const ShowdownStruct& sd = gs.showdown_players[i];
+        ShowdownRecord& sd_record = record.showdown_players[i];
+        sd_record.total_chips_bet = sd.total_chips_bet;
+        sd_record.chips_won = sd.chips_won;
+        sd_record.player_idx = static_cast<std::int8_t>(sd.player_idx);
+        sd_record.hand_rank = byte(to_underlying(sd.hand_rank));
+        std::transform(sd.best_hand.begin(), sd.best_hand.end(),
+            sd_record.best_hand.begin(), card);
+    }
+    for (size_t i = 0; i < gs.blinds.size(); i++)
+    {
+        record.blinds[i] = byte(to_underlying(gs.blinds[i]));
+    }
+    for (size_t i = 0; i < gs.last_actions.size(); i++)
+    {
+        record.last_actions[i] = byte(to_underlying(gs.last_actions[i]));
+    }
+    for (size_t i = 0; i < gs.ai_types.size(); i++)
+    {
+        record.ai_types[i] = byte(to_underlying(gs.ai_types[i]));
+    }
+    for (size_t i = 0; i < gs.hole_cards.size(); i++)
+    {
+        record.hole_cards[2 * i] = card(gs.hole_cards[i].first);
+        record.hole_cards[2 * i + 1] = card(gs.hole_cards[i].second);
+    }
+    for (size_t i = 0; i < gs.best_hands.size(); i++)
+    {
+        std::transform(gs.best_hands[i].begin(), gs.best_hands[i].end(),
+            record.best_hands[i].begin(), card);
+    }
+    for (size_t i = 0; i < gs.hand_ranks.size(); i++)
+    {
+        record.hand_ranks[i] = byte(to_underlying(gs.hand_ranks[i]));
+    }
+    std::transform(gs.best_hand.begin(), gs.best_hand.end(),
+        record.best_hand.begin(), card);
+    std::transform(gs.available_cards.begin(), gs.available_cards.end(),
+        record.available_cards.begin(), card);
+    for (size_t i = 0; i < gs.legal_actions.size(); i++)
+    {
+        record.legal_actions[i] = byte(to_underlying(gs.legal_actions[i]));
+    }
+    record.board_cards = { card(gs.flop_card1), card(gs.flop_card2),
+        card(gs.flop_card3), card(gs.turn_card), card(gs.river_card) };
+    record.round = byte(to_underlying(gs.round));
+    record.player_action = byte(to_underlying(gs.player_action));
+    record.legal_to_raise = gs.legal_to_raise;
+    record.raise_active = gs.raise_active;
+    record.all_in_below_min_raise = gs.all_in_below_min_raise;
+    record.num_blinds = byte(gs.blinds.size());
+    record.num_last_actions = byte(gs.last_actions.size());
+    record.num_ai_types = byte(gs.ai_types.size());
+    record.num_hole_cards = byte(gs.hole_cards.size());
+    record.num_best_hands = byte(gs.best_hands.size());
+    record.num_hand_ranks = byte(gs.hand_ranks.size());
+    record.num_remaining_players = byte(gs.remaining_players.size());
+    record.num_player_chip_counts = byte(gs.player_chip_counts.size());
+    record.num_active_player_list = byte(gs.active_player_list.size());
+    record.num_available_cards = byte(gs.num_available_cards);
+    record.available_cards_size = byte(gs.available_cards.size());
+    record.num_legal_actions = byte(gs.num_legal_actions);
+    record.legal_actions_size = byte(gs.legal_actions.size());
+    record.num_win_perc = byte(gs.win_perc.size());
+    record.num_showdown_players = byte(gs.num_showdown_players);
+    record.showdown_players_size = byte(gs.showdown_players.size());
+    return record;
+}
+
+GameState decode_game_state(const GameStateRecord& record)
+{
+    /**
+     * Convert a file record back into the game state it was encoded from.
+    */
+    GameState gs{};
+    auto card = [](std::uint8_t idx) { return index_to_card(idx); };
+    gs.win_perc.resize(record.num_win_perc);
+    std::copy_n(record.win_perc.begin(), gs.win_perc.size(), gs.win_perc.begin());
+    gs.random_seed = record.random_seed;
+    gs.tournament_number = record.tournament_number;
+    gs.game_number = record.game_number;
+    gs.num_games_per_blind_level = record.num_games_per_blind_level;
+    gs.initial_num_players = record.initial_num_players;
+    gs.num_players = record.num_players;
+    gs.num_active_players = record.num_active_players;
+    gs.action_number = record.action_number;
+    gs.player_idx = record.player_idx;
+    gs.raise_player_idx = record.raise_player_idx;
+    gs.sum_prev_bets = record.sum_prev_bets;
+    gs.pot_chip_count = record.pot_chip_count;
+    gs.chips_to_call = record.chips_to_call;
+    gs.min_bet = record.min_bet;
+    gs.max_bet = record.max_bet;
+    gs.min_to_raise = record.min_to_raise;
+    gs.player_bet = record.player_bet;
+    for (int i = 0; i < MAX_PLAYER_COUNT; i++)
+    {
+        std::copy(record.pot_player_bets[i].begin(),
+            record.pot_player_bets[i].end(), gs.pot_player_bets[i].begin());
+    }
+    gs.player_chip_counts.resize(record.num_player_chip_counts);
+    std::copy_n(record.player_chip_counts.begin(),
+        gs.player_chip_counts.size(), gs.player_chip_counts.begin());
+    gs.remaining_players.resize(record.num_remaining_players);
+    std::copy_n(record.remaining_players.begin(),
+        gs.remaining_players.size(), gs.remaining_players.begin());
+    gs.active_player_list.resize(record.num_active_player_list);
+    std::copy_n(record.active_player_list.begin(),
+        gs.active_player_list.size(), gs.active_player_list.begin());
+    for (size_t i = 0; i < record.showdown_players_size; i++)
+    {
+        const ShowdownRecord& sd_record = record.showdown_players[i];
+        ShowdownStruct sd;
+        sd.player_idx = sd_record.player_idx;
+        std::transform(sd_record.best_hand.begin(), sd_record.best_hand.end(),
+            sd.best_hand.begin(), card);
+        sd.hand_rank = static_cast<HandRank>(sd_record.hand_rank);
+        sd.total_chips_bet = sd_record.total_chips_bet;
+        sd.chips_won = sd_record.chips_won;
+        sd.hand_strength = hand_strength_key(sd.best_hand);
+        gs.showdown_players.push_back(sd);
+    }
+    for (size_t i = 0; i < record.num_blinds; i++)
+    {
+        gs.blinds.push_back(static_cast<Blind>(record.blinds[i]));
+    }
+    for (size_t i = 0; i < record.num_last_actions; i++)
+    {
+        gs.last_actions.push_back(static_cast<Action>(record.last_actions[i]));
+    }
+    for (size_t i = 0; i < record.num_ai_types; i++)
+    {
+        gs.ai_types.push_back(static_cast<AI_Type>(record.ai_types[i]));
+    }
+    for (size_t i = 0; i < record.num_hole_cards; i++)
+    {
+        gs.hole_cards.push_back(std::make_pair(
+            card(record.hole_cards[2 * i]), card(record.hole_cards[2 * i + 1])));
+    }
+    gs.best_hands.resize(record.num_best_hands);
+    for (size_t i = 0; i < gs.best_hands.size(); i++)
+    {
+        std::transform(record.best_hands[i].begin(), record.best_hands[i].end(),
+            gs.best_hands[i].begin(), card);
+    }
+    for (size_t i = 0; i < record.num_hand_ranks; i++)
+    {
+        gs.hand_ranks.push_back(static_cast<HandRank>(record.hand_ranks[i]));
+    }
+    std::transform(record.best_hand.begin(), record.best_hand.end(),
+        gs.best_hand.begin(), card);
+    gs.num_available_cards = record.num_available_cards;
+    for (size_t i = 0; i < record.available_cards_size; i++)
+    {
+        gs.available_cards.push_back(card(record.available_cards[i]));
+    }
+    gs.num_legal_actions = record.num_legal_actions;
+    for (size_t i = 0; i < record.legal_actions_size; i++)
+    {
+        gs.legal_actions.push_back(static_cast<Action>(record.legal_actions[i]));
+    }
+    gs.flop_card1 = card(record.board_cards[0]);
+    gs.flop_card2 = card(record.board_cards[1]);
+    gs.flop_card3 = card(record.board_cards[2]);
+    gs.turn_card = card(record.board_cards[3]);
+    gs.river_card = card(record.board_cards[4]);
+    gs.round = static_cast<Round>(record.round);
+    gs.player_action = static_cast<Action>(record.player_action);
+    gs.legal_to_raise = record.legal_to_raise != 0;
+    gs.raise_active = record.raise_active != 0;
+    gs.all_in_below_min_raise = record.all_in_below_min_raise != 0;
+    gs.num_showdown_players = record.num_showdown_players;
+    return gs;
+}
+
+GameHistory read_game_record(std::ifstream& fs)
+{
+    /**
+     * Read a game written by write_game_record() with one block read.
+     *
+     * @throws std::runtime_error if the file ends inside the game.
+    */
+    GameHistory gh;
+    GameRecordHeader header;
+    fs.read(reinterpret_cast<char*>(&header), sizeof header);
+    gh.game_number = header.game_number;
+    gh.num_states = header.num_states;
+    vector<GameStateRecord> records(gh.num_states);
+    fs.read(reinterpret_cast<char*>(records.data()),
+        static_cast<std::streamsize>(sizeof(GameStateRecord) * records.size()));
+    if (!fs)
     {
-        fs.read(reinterpret_cast<char*>(&th.tournament_number), sizeof th.tournament_number);
-        fs.read(reinterpret_cast<char*>(&th.random_seed), sizeof th.random_seed);
-        fs.read(reinterpret_cast<char*>(&th.initial_player_count), sizeof th.initial_player_count);
+        throw std::runtime_error("Tournament file is truncated!");
+    }
+    gh.states.reserve(records.size());
+    for (const auto& record : records)
+    {
+        gh.states.push_back(decode_game_state(record));
+    }
+    return gh;
+}
 
-        th.player_ai_types.resize(th.initial_player_count);
-        fs.read(reinterpret_cast<char*>(&th.player_ai_types[0]),
-            sizeof(th.player_ai_types[0]) * th.initial_player_count);
+void write_game_record(std::ofstream& fs, const GameHistory& gh)
+{
+    /**
+     * Write a game header followed by all of its states as one block.
+    */
+    GameRecordHeader header{};
+    header.game_number = gh.game_number;
+    header.num_states = gh.states.size();
+    vector<GameStateRecord> records;
+    records.reserve(gh.states.size());
+    for (const auto& gs : gh.states)
+    {
+        records.push_back(encode_game_state(gs));
+    }
+    fs.write(reinterpret_cast<const char*>(&header), sizeof header);
+    fs.write(reinterpret_cast<const char*>(records.data()),
+        static_cast<std::streamsize>(sizeof(GameStateRecord) * records.size()));
+}
 
-        th.finishing_order.resize(th.initial_player_count);
-        fs.read(reinterpret_cast<char*>(&th.finishing_order[0]),
-            sizeof(th.finishing_order[0]) * th.initial_player_count);
+bool check_tournament_file_header(const TournamentFileHeader& header)
+{
+    /**
+     * Check that a header belongs to a versioned tournament file that can be
+     * read on this machine.
+     *
+     * @param header is the first bytes of a tournament file.
+     * @return False if the file does not start with a versioned header.
+     * @throws std::runtime_error if the file is versioned but was written
+     *         with a different byte order, version or record size, or its
+     *         player count is out of range.
+    */
+    if (std::memcmp(header.magic, TOURNAMENT_FILE_MAGIC,
+        sizeof TOURNAMENT_FILE_MAGIC) != 0)
+    {
+        return false;
+    }
+    if (header.endian_marker != ENDIAN_MARKER)
+    {
+        throw std::runtime_error(
+            "Tournament file was written with a different byte order!");
+    }
+    if (header.version != TOURNAMENT_FILE_VERSION ||
+        header.state_size != sizeof(GameStateRecord))
+    {
+        throw std::runtime_error("Tournament file is not a version " +
+            std::to_string(TOURNAMENT_FILE_VERSION) + " file!");
+    }
+    if (header.initial_player_count < MIN_PLAYER_COUNT ||
+        header.initial_player_count > MAX_PLAYER_COUNT)
+    {
+        throw std::runtime_error("Tournament file has an invalid player count!");
+    }
+    return true;
+}
 
-        th.game_eliminated.resize(th.initial_player_count);
-        fs.read(reinterpret_cast<char*>(&th.game_eliminated[0]),
-            sizeof(th.game_eliminated[0]) * th.initial_player_count);
+bool read_tournament_file_header(std::ifstream& fs, TournamentFileHeader& header)
+{
+    /**
+     * Read the header of a versioned tournament file.
+     *
+     * @param fs is a stream positioned at the start of the file.
+     * @param header is filled in from the file.
+     * @return False if the file does not start with a versioned header.
+     * @throws std::runtime_error if the versioned file can't be read here.
+    */
+    fs.read(reinterpret_cast<char*>(&header), sizeof header);
+    return fs && check_tournament_file_header(header);
+}
 
-        fs.read(reinterpret_cast<char*>(&th.num_games), sizeof th.num_games);
+bool check_game_index_footer(
+    const GameIndexFooter& footer,
+    const TournamentFileHeader& header,
+    size_t file_size)
+{
+    /**
+     * Check that a footer is a game index that matches the file.
+     *
+     * @param footer is the last bytes of a tournament file.
+     * @param header is the header of the same file.
+     * @param file_size is the size of the file in bytes.
+     * @return False if the file has no usable game index.
+    */
+    return std::memcmp(footer.magic, GAME_INDEX_MAGIC, sizeof GAME_INDEX_MAGIC) == 0 &&
+        footer.num_games == header.num_games &&
+        file_size >= sizeof(TournamentFileHeader) + sizeof(GameIndexFooter) +
+        sizeof(GameIndexEntry) * footer.num_games;
+}
 
-        if (!summary)  // For Python code to get summary of tourament results
+vector<GameIndexEntry> read_game_index(
+    std::ifstream& fs,
+    const TournamentFileHeader& header)
+{
+    /**
+     * Read the offset of every game in a versioned tournament file.
+     *
+     * The index is read from the footer of the file.  If the file has no
+     * footer, because the tournament is still being written or was
+     * interrupted, the game record headers are read instead to locate each
+     * complete game, skipping over the states.
+     *
+     * @param fs is a stream of the tournament file.
+     * @param header is the header of the same file.
+     * @return One entry per game in the order they were played.
+    */
+    vector<GameIndexEntry> index;
+    fs.clear();
+    fs.seekg(0, std::ios::end);
+    size_t file_size = static_cast<size_t>(fs.tellg());
+    GameIndexFooter footer{};
+    if (file_size >= sizeof(TournamentFileHeader) + sizeof footer)
+    {
+        fs.seekg(static_cast<std::streamoff>(file_size - sizeof footer));
+        fs.read(reinterpret_cast<char*>(&footer), sizeof footer);
+        if (fs && check_game_index_footer(footer, header, file_size))
         {
-            for (size_t i = 0; i < th.num_games; i++)
-            {
-                th.games.push_back(read_gamehistory(fs));
-            }
+            index.resize(footer.num_games);
+            fs.seekg(static_cast<std::streamoff>(file_size - sizeof footer -
+                sizeof(GameIndexEntry) * index.size()));
+            fs.read(reinterpret_cast<char*>(index.data()),
+                static_cast<std::streamsize>(sizeof(GameIndexEntry) * index.size()));
+            if (fs) { return index; }
+        }
+    }
+    // No footer, so locate each game from the game record headers.  The
+    // header's game count is only written at close, so walk the records until
+    // the end of the file or a game that was cut off while being written.
+    index.clear();
+    fs.clear();
+    size_t offset = sizeof(TournamentFileHeader);
+    while (offset + sizeof(GameRecordHeader) <= file_size)
+    {
+        GameRecordHeader record;
+        fs.seekg(static_cast<std::streamoff>(offset));
+        fs.read(reinterpret_cast<char*>(&record), sizeof record);
+        if (!fs) { break; }
+        size_t record_size = sizeof record +
+            sizeof(GameStateRecord) * static_cast<size_t>(record.num_states);
+        if (record.num_states > file_size || offset + record_size > file_size)
+        {
+            break;
         }
+        index.push_back({ record.game_number, 0, offset, record.num_states });
+        offset += record_size;
+    }
+    fs.clear();
+    return index;
+}
+
+GameHistory read_game(string filename, size_t game_idx)
+{
+    /**
+     * Read one game of a tournament file without reading any other game.
+     *
+     * @throws std::out_of_range if the file has no game game_idx.
+     * @throws std::runtime_error if the file can't be read.
+    */
+    vector<GameHistory> games = read_games(filename, game_idx, 1);
+    if (games.empty())
+    {
+        throw std::out_of_range("Game " + std::to_string(game_idx) +
+            " is not in " + filename);
+    }
+    return games[0];
+}
+
+vector<GameHistory> read_games(
+    string filename,
+    size_t first_game,
+    size_t num_games)
+{
+    /**
+     * Read a range of games of a tournament file.
+     *
+     * Versioned files seek directly to the first game using the game index.
+     * Files in the original format have no index and are read from the start.
+     *
+     * @param filename is the path of the tournament file.
+     * @param first_game is the index of the first game to read.
+     * @param num_games is the maximum number of games to read.
+     * @return The games in the range that exist in the file.
+     * @throws std::runtime_error if the file can't be read.
+    */
+    vector<GameHistory> games;
+    std::ifstream fs(filename, std::ios::in | std::ios::binary);
+    if (!fs.is_open())
+    {
+        throw std::runtime_error("Failed to open " + filename);
+    }
+    TournamentFileHeader header;
+    if (!read_tournament_file_header(fs, header))
+    {
+        fs.close();
+        TournamentHistory th = read_tournamenthistory(filename);
+        for (size_t i = first_game;
+            i < th.games.size() && i - first_game < num_games; i++)
+        {
+            games.push_back(th.games[i]);
+        }
+        return games;
+    }
+    vector<GameIndexEntry> index = read_game_index(fs, header);
+    for (size_t i = first_game;
+        i < index.size() && i - first_game < num_games; i++)
+    {
+        fs.seekg(static_cast<std::streamoff>(index[i].offset));
+        games.push_back(read_game_record(fs));
     }
     fs.close();
-    return th;
+    return games;
 }
 
-void write_tournamenthistory(string filename, TournamentHistory& th)
+TournamentHistory read_tournamenthistory(string filename, bool summary)
 {
-    std::ofstream fs(filename, std::ios::out | std::ios::binary);
+    /**
+     * Read a tournament history from a file.
+     *
+     * Versioned files are read with one block per game.  Files written before
+     * the versioned format are read field by field.
+     *
+     * @param filename is the path of the tournament file.
+     * @param summary skips reading the games if true.
+     * @return The tournament history.
+     * @throws std::runtime_error if the file can't be opened or the
+     *         versioned file can't be read here.
+    */
+    TournamentHistory th;
+    std::ifstream fs(filename, std::ios::in | std::ios::binary);
     if (!fs.is_open())
     {
-        cout << "Failed to open " << filename << endl;
-        exit(-1);
+        throw std::runtime_error("Failed to open " + filename);
     }
-    else
+    TournamentFileHeader header;
+    if (read_tournament_file_header(fs, header))
     {
-        fs.write(reinterpret_cast<char*>(&th.tournament_number), sizeof th.tournament_number);
-        fs.write(reinterpret_cast<char*>(&th.random_seed), sizeof th.random_seed);
-        fs.write(reinterpret_cast<char*>(&th.initial_player_count), sizeof th.initial_player_count);
+        size_t player_count = static_cast<size_t>(header.initial_player_count);
+        th.tournament_number = header.tournament_number;
+        th.random_seed = header.random_seed;
+        th.initial_player_count = header.initial_player_count;
+        th.player_ai_types.assign(header.player_ai_types.begin(),
+            header.player_ai_types.begin() + player_count);
+        th.finishing_order.assign(header.finishing_order.begin(),
+            header.finishing_order.begin() + player_count);
+        th.game_eliminated.assign(header.game_eliminated.begin(),
+            header.game_eliminated.begin() + player_count);
+        // Count the games from the index, since the header of an unfinished
+        // file still says zero
+        vector<GameIndexEntry> index = read_game_index(fs, header);
+        th.num_games = index.size();
+        if (!summary)  // For Python code to get summary of tourament results
+        {
+            th.games.reserve(th.num_games);
+            for (const auto& entry : index)
+            {
+                fs.seekg(static_cast<std::streamoff>(entry.offset));
+                th.games.push_back(read_game_record(fs));
+            }
+        }
+        fs.close();
+        return th;
+    }
+    // Unversioned file
+    fs.clear();
+    fs.seekg(0);
+    fs.read(reinterpret_cast<char*>(&th.tournament_number), sizeof th.tournament_number);
+    fs.read(reinterpret_cast<char*>(&th.random_seed), sizeof th.random_seed);
+    fs.read(reinterpret_cast<char*>(&th.initial_player_count), sizeof th.initial_player_count);
+
+    th.player_ai_types.resize(th.initial_player_count);
+    fs.read(reinterpret_cast<char*>(&th.player_ai_types[0]),
+        sizeof(th.player_ai_types[0]) * th.initial_player_count);
 
-        fs.write(reinterpret_cast<char*>(&th.player_ai_types[0]),
-            sizeof(th.player_ai_types[0]) * th.initial_player_count);
+    th.finishing_order.resize(th.initial_player_count);
+    fs.read(reinterpret_cast<char*>(&th.finishing_order[0]),
+        sizeof(th.finishing_order[0]) * th.initial_player_count);
 
-        fs.write(reinterpret_cast<char*>(&th.finishing_order[0]),
-            sizeof(th.finishing_order[0]) * th.initial_player_count);
+    th.game_eliminated.resize(th.initial_player_count);
+    fs.read(reinterpret_cast<char*>(&th.game_eliminated[0]),
+        sizeof(th.game_eliminated[0]) * th.initial_player_count);
 
-        fs.write(reinterpret_cast<char*>(&th.game_eliminated[0]),
-            sizeof(th.game_eliminated[0]) * th.initial_player_count);
+    fs.read(reinterpret_cast<char*>(&th.num_games), sizeof th.num_games);
 
-        fs.write(reinterpret_cast<char*>(&th.num_games), sizeof th.num_games);
+    if (!summary)  // For Python code to get summary of tourament results
+    {
         for (size_t i = 0; i < th.num_games; i++)
         {
-            write_gamehistory(fs, th.games[i]);
+            th.games.push_back(read_gamehistory(fs));
         }
     }
     fs.close();
+    return th;
+}
+
+void write_tournamenthistory(string filename, TournamentHistory& th)
+{
+    TournamentWriter writer;
+    writer.open(filename, th);
+    for (size_t i = 0; i < th.num_games; i++)
+    {
+        writer.append_game(th.games[i]);
+    }
+    writer.close(th);
 }
 
+/* TournamentWriter Method Definitions
+******************************************************************************/
+void TournamentWriter::append_game(GameHistory& gh)
+{
+    /**
+     * Append a completed game to the end of the file.
+    */
+    assert(is_open() && "Tournament writer is not open!");
+    GameIndexEntry entry{};
+    entry.game_number = gh.game_number;
+    entry.offset = static_cast<std::uint64_t>(std::streamoff(m_fs.tellp()));
+    entry.num_states = gh.states.size();
+    m_index.push_back(entry);
+    write_game_record(m_fs, gh);
+    m_header.num_games++;
+}
+
+void TournamentWriter::close(TournamentHistory& th)
+{
+    /**
+     * Append the game index, patch the tournament results into the header
+     * and close the file.
+     *
+     * @param th is the tournament history, whose finishing order and game
+     * eliminated must list every player.  Its number of games is set to the
+     * number of games appended.
+    */
+    assert(is_open() && "Tournament writer is not open!");
+    assert((th.finishing_order.size() == static_cast<size_t>(th.initial_player_count) &&
+        th.game_eliminated.size() == static_cast<size_t>(th.initial_player_count)) &&
+        "Tournament results must list every player!");
+    th.num_games = m_header.num_games;
+    std::copy(th.finishing_order.begin(), th.finishing_order.end(),
+        m_header.finishing_order.begin());
+    std::copy(th.game_eliminated.begin(), th.game_eliminated.end(),
+        m_header.game_eliminated.begin());
+    GameIndexFooter footer{};
+    std::copy(std::begin(GAME_INDEX_MAGIC), std::end(GAME_INDEX_MAGIC),
+        footer.magic);
+    footer.num_games = m_index.size();
+    m_fs.write(reinterpret_cast<char*>(m_index.data()),
+        static_cast<std::streamsize>(sizeof(GameIndexEntry) * m_index.size()));
+    m_fs.write(reinterpret_cast<char*>(&footer), sizeof footer);
+    m_fs.seekp(0);
+    m_fs.write(reinterpret_cast<char*>(&m_header), sizeof m_header);
+    m_fs.close();
+}
+
+bool TournamentWriter::is_open() const
+{
+    return m_fs.is_open();
+}
+
+void TournamentWriter::open(string filename, TournamentHistory& th)
+{
+    /**
+     * Create the file and write the tournament header.
+     *
+     * @param filename is the path of the file to create.
+     * @param th is the tournament history; only the fields known before the
+     * first game (tournament number, seed and AI types) are written.
+    */
+    m_fs.open(filename, std::ios::out | std::ios::binary);
+    if (!m_fs.is_open())
+    {
+        cout << "Failed to open " << filename << endl;
+        exit(-1);
+    }
+    m_header = TournamentFileHeader{};
+    m_index.clear();
+    std::copy(std::begin(TOURNAMENT_FILE_MAGIC), std::end(TOURNAMENT_FILE_MAGIC),
+        m_header.magic);
+    m_header.version = TOURNAMENT_FILE_VERSION;
+    m_header.endian_marker = ENDIAN_MARKER;
+    m_header.state_size = sizeof(GameStateRecord);
+    m_header.tournament_number = th.tournament_number;
+    m_header.random_seed = th.random_seed;
+    m_header.initial_player_count = th.initial_player_count;
+    std::copy(th.player_ai_types.begin(), th.player_ai_types.end(),
+        m_header.player_ai_types.begin());
+    // Placeholders until the tournament results are known
+    m_header.finishing_order.fill(-1);
+    m_header.game_eliminated.fill(-1);
+    m_fs.write(reinterpret_cast<char*>(&m_header), sizeof m_header);
+}
+
+/* Utility Function Definitions
+******************************************************************************/
 std::string create_timestamp()
 {
     auto now = std::chrono::system_clock::now();
@@ -382,89 +952,141 @@ std::string get_date()
 void write_nn_vector_data(
     std::string read_filename, std::string write_filename)
 {
-    vector<double> nn_vector;
-    TournamentHistory th = read_tournamenthistory(read_filename);
+    /**
+     * Append the neural network input vector of every recorded state.
+     *
+     * Versioned files are mapped and each state record is decoded as it is
+     * visited; older files are deserialized first.
+     *
+     * @throws std::runtime_error if either file can't be opened.
+    */
+    array<double, NN_VECTOR_SIZE> nn_vector;
     std::ofstream fs(write_filename, std::ios::app | std::ios::binary);
     if (!fs.is_open())
     {
-        cout << "Failed to open " << write_filename << endl;
-        exit(-1);
+        throw std::runtime_error("Failed to open " + write_filename);
+    }
+    auto write_state = [&](const GameState& gs)
+        {
+            encode_nn_inputs(gs, nn_vector.data());
+            encode_nn_labels(gs, nn_vector.data() + NN_INPUT_SIZE);
+            fs.write(reinterpret_cast<char*>(&nn_vector[0]),
+                sizeof(nn_vector[0]) * NN_VECTOR_SIZE);
+        };
+    TournamentView view;
+    if (view.open(read_filename))
+    {
+        for (size_t i = 0; i < view.num_games(); i++)
+        {
+            for (const auto& record : view.game(i))
+            {
+                write_state(decode_game_state(record));
+            }
+        }
     }
     else
     {
+        TournamentHistory th = read_tournamenthistory(read_filename);
         for (const auto& gh : th.games)
         {
             for (const auto& gs : gh.states)
             {
-                nn_vector = game_state_to_nn_vector(gs);
-                fs.write(reinterpret_cast<char*>(&nn_vector[0]),
-                    sizeof(nn_vector[0]) * NN_VECTOR_SIZE);
+                write_state(gs);
             }
         }
     }
     fs.close();
 }
 
-vector<double> game_state_to_nn_vector(GameState gs)
+template<typename T>
+void encode_nn_inputs(const GameState& gs, T* inputs)
 {
-    vector<double> nn_vector(NN_VECTOR_SIZE, 0);
+    /**
+     * Write the neural network inputs of the player to act into storage.
+     *
+     * Nothing is allocated, so inputs can be a row of a batch tensor or of a
+     * flat buffer.
+     *
+     * @param gs is the game state before the player acts.
+     * @param inputs is storage for NN_INPUT_SIZE values.
+    */
+    std::fill_n(inputs, NN_INPUT_SIZE, T(0));
+    auto encode_card = [inputs](int idx, const Card& card)
+        {
+            inputs[idx] = static_cast<T>(to_underlying(card.rank) / 14.0);
+            int suit_idx = return_suit_one_hot(card.suit);
+            if (suit_idx != 0) { inputs[idx + suit_idx] = 1; }
+        };
+    const double max_chips =
+        static_cast<double>(gs.initial_num_players * MAX_BUY_IN);
     // Legal actions (7 inputs)
     for (const auto& act : gs.legal_actions)
     {
-        nn_vector[to_underlying(act) - 1] = 1;
+        inputs[to_underlying(act) - 1] = 1;
     }
     // Hole Cards (10 inputs)
-    nn_vector[7] = to_underlying(gs.hole_cards[gs.player_idx].first.rank) / 14.0;
-    int suit_idx = return_suit_one_hot(gs.hole_cards[gs.player_idx].first.suit);
-    if (suit_idx != 0) { nn_vector[7 + suit_idx] = 1; }
-    nn_vector[12] = to_underlying(gs.hole_cards[gs.player_idx].second.rank) / 14.0;
-    suit_idx = return_suit_one_hot(gs.hole_cards[gs.player_idx].second.suit);
-    if (suit_idx != 0) { nn_vector[12 + suit_idx] = 1; }
+    encode_card(7, gs.hole_cards[gs.player_idx].first);
+    encode_card(12, gs.hole_cards[gs.player_idx].second);
     // Flop cards (15 inputs)
-    nn_vector[17] = to_underlying(gs.flop_card1.rank) / 14.0;
-    suit_idx = return_suit_one_hot(gs.flop_card1.suit);
-    if (suit_idx != 0) { nn_vector[17 + suit_idx] = 1; }
-    nn_vector[22] = to_underlying(gs.flop_card2.rank) / 14.0;
-    suit_idx = return_suit_one_hot(gs.flop_card2.suit);
-    if (suit_idx != 0) { nn_vector[22 + suit_idx] = 1; }
-    nn_vector[27] = to_underlying(gs.flop_card3.rank) / 14.0;
-    suit_idx = return_suit_one_hot(gs.flop_card3.suit);
-    if (suit_idx != 0) { nn_vector[27 + suit_idx] = 1; }
+    encode_card(17, gs.flop_card1);
+    encode_card(22, gs.flop_card2);
+    encode_card(27, gs.flop_card3);
     // Turn card (5 inputs)
-    nn_vector[32] = to_underlying(gs.turn_card.rank) / 14.0;
-    suit_idx = return_suit_one_hot(gs.turn_card.suit);
-    if (suit_idx != 0) { nn_vector[32 + suit_idx] = 1; }
+    encode_card(32, gs.turn_card);
     // River card (5 inputs)
-    nn_vector[37] = to_underlying(gs.river_card.rank) / 14.0;
-    suit_idx = return_suit_one_hot(gs.river_card.suit);
-    if (suit_idx != 0) { nn_vector[37 + suit_idx] = 1; }
+    encode_card(37, gs.river_card);
     // Chips to call (1 input)
-    nn_vector[42] = gs.chips_to_call /
-        static_cast<double>(gs.initial_num_players * MAX_BUY_IN);
+    inputs[42] = static_cast<T>(gs.chips_to_call / max_chips);
     // Stack size / max bet (1 input)
-    nn_vector[43] = gs.max_bet /
-        static_cast<double>(gs.initial_num_players * MAX_BUY_IN);
+    inputs[43] = static_cast<T>(gs.max_bet / max_chips);
     // Total amount in pot (1 input)
-    nn_vector[44] = gs.pot_chip_count /
-        static_cast<double>(gs.initial_num_players * MAX_BUY_IN);
+    inputs[44] = static_cast<T>(gs.pot_chip_count / max_chips);
     // Amount in pot from player (1 input)
-    nn_vector[45] = get_total_player_bets(gs.player_idx, gs.pot_player_bets) /
-        static_cast<double>(gs.initial_num_players * MAX_BUY_IN);
+    inputs[45] = static_cast<T>(
+        get_total_player_bets(gs.player_idx, gs.pot_player_bets) / max_chips);
     // Position/blinds (11 inputs)
     int blind_idx = to_underlying(gs.blinds[gs.player_idx]);
-    if (blind_idx != 0) { nn_vector[45 + blind_idx] = 1; }
+    if (blind_idx != 0) { inputs[45 + blind_idx] = 1; }
     // Hand rank (1 input)
-    nn_vector[57] = to_underlying(gs.hand_ranks[gs.player_idx]) / 11.0;
+    inputs[57] = static_cast<T>(to_underlying(gs.hand_ranks[gs.player_idx]) / 11.0);
     // Number of active (unfolded) players remaining (1 input)
-    nn_vector[58] = gs.num_active_players /
-        static_cast<double>(gs.initial_num_players);
+    inputs[58] = static_cast<T>(gs.num_active_players /
+        static_cast<double>(gs.initial_num_players));
     // Number of players remaining in tournament (1 input)
-    nn_vector[59] = gs.num_players /
-        static_cast<double>(gs.initial_num_players);
+    inputs[59] = static_cast<T>(gs.num_players /
+        static_cast<double>(gs.initial_num_players));
+}
+
+template<typename T>
+void encode_nn_labels(const GameState& gs, T* labels)
+{
+    /**
+     * Write the action chosen by the player and its bet into storage.
+     *
+     * @param gs is the game state after the player acts.
+     * @param labels is storage for NN_VECTOR_SIZE - NN_INPUT_SIZE values.
+    */
+    std::fill_n(labels, NN_VECTOR_SIZE - NN_INPUT_SIZE, T(0));
     // One-hot encoding of chosen action (7 outputs)
-    nn_vector[60 + to_underlying(gs.player_action) - 1] = 1;
+    if (gs.player_action != Action::No_Action)
+    {
+        labels[to_underlying(gs.player_action) - 1] = 1;
+    }
     // Player bet scaled by player's stack size (1 output)
-    nn_vector[67] = static_cast<double>(gs.player_bet) / gs.max_bet;
+    labels[LEGAL_ACTION_COUNT] =
+        static_cast<T>(static_cast<double>(gs.player_bet) / gs.max_bet);
+}
+
+template void encode_nn_inputs<float>(const GameState& gs, float* inputs);
+template void encode_nn_inputs<double>(const GameState& gs, double* inputs);
+template void encode_nn_labels<float>(const GameState& gs, float* labels);
+template void encode_nn_labels<double>(const GameState& gs, double* labels);
+
+vector<double> game_state_to_nn_vector(const GameState& gs)
+{
+    vector<double> nn_vector(NN_VECTOR_SIZE);
+    encode_nn_inputs(gs, nn_vector.data());
+    encode_nn_labels(gs, nn_vector.data() + NN_INPUT_SIZE);
     return nn_vector;
 }
 
@@ -482,8 +1104,8 @@ int return_suit_one_hot(Suit suit)
 
 unsigned get_total_player_bets(
     int player_idx,
-    std::array<
-    std::array<unsigned, constants::MAX_BETTING_ROUNDS>, constants::MAX_PLAYER_COUNT>
+    const std::array<
+    std::array<unsigned, constants::MAX_BETTING_ROUNDS>, constants::MAX_PLAYER_COUNT>&
     m_player_bets
 )
 {
@@ -12,6 +12,7 @@
 // Project headers
 #include "cards.hpp"
 #include "constants.hpp"
+#include "evaluator.hpp"
 #include "player.hpp"
 #include "storage.hpp"
 #include "texasholdem.hpp"
@@ -29,6 +30,19 @@ using namespace constants;
 
 /* ShowdownStruct Method Definitions
 ******************************************************************************/
+ShowdownStruct::ShowdownStruct(
+    int idx,
+    array<Card, MAX_CARDS_IN_HAND> sh,
+    HandRank hr,
+    unsigned chips_bet,
+    unsigned chips_won) :
+    player_idx(idx),
+    best_hand(sh),
+    hand_rank(hr),
+    total_chips_bet(chips_bet),
+    chips_won(chips_won),
+    hand_strength(hand_strength_key(sh)) {}
+
 Rank ShowdownStruct::identify_card_groups(
     const array<Card, MAX_CARDS_IN_HAND> best_hand,
     int group_size,
@@ -102,6 +116,14 @@ bool ShowdownStruct::operator>(const ShowdownStruct& other) const
      * @param other is another ShowdownStruct.
      * @return True if the ShowdownStruct has a stronger poker hand.
     */
+    if constexpr (USE_LOOKUP_EVALUATOR)
+    {
+        if (hand_strength != other.hand_strength)
+        {
+            return hand_strength > other.hand_strength;
+        }
+        return total_chips_bet < other.total_chips_bet;
+    }
     if (hand_rank > other.hand_rank)
     {
         return true;
@@ -279,6 +301,10 @@ bool ShowdownStruct::operator==(const ShowdownStruct& other)
      * @param other is another ShowdownStruct.
      * @return True if the ShowdownStructs have equal strength poker hands.
     */
+    if constexpr (USE_LOOKUP_EVALUATOR)
+    {
+        return hand_strength == other.hand_strength;
+    }
     if (hand_rank != other.hand_rank) { return false; }
     for (int i = MAX_CARDS_IN_HAND - 1; i >= 0; i--)
     {
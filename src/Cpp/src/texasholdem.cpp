@@ -57,10 +57,11 @@ void TexasHoldEm::begin_tournament()
     {
         m_load_script(gs);
     }
-    else
+    else if (!m_monte_carlo_game)
     {
-        m_begin_game(gs);
+        m_open_tournament_file();
     }
+    m_game_loop(gs);
 }
 
 void TexasHoldEm::begin_test_game(TestCase tc)
@@ -91,12 +92,16 @@ void TexasHoldEm::begin_mc_game(vector<Card> starting_hand, size_t num_runs)
     m_monte_carlo_game = true;
     m_build_partial_deck(starting_hand);
     m_mc_deck.resize(NUMBER_CARDS_IN_DECK);
+    // Hole cards, three burn cards and five community cards are dealt
+    const int num_draws = 2 * initial_num_players + 8 -
+        static_cast<int>(starting_hand.size());
     for (size_t i = 0; i < num_runs; i++)
     {
-        std::shuffle(m_partial_deck.begin(), m_partial_deck.end(), rng);
+        partial_shuffle(m_partial_deck.data(),
+            static_cast<int>(m_partial_deck.size()), num_draws, rng);
         m_build_mc_deck(starting_hand);
         dealer.stack_the_deck(m_mc_deck);
-        tourn_hist.games.clear();
+        tourn_hist.num_games = 0;
         game_hist.states.clear();
         for (auto& player : full_player_list)
         {
@@ -112,10 +117,50 @@ void TexasHoldEm::begin_mc_game(vector<Card> starting_hand, size_t num_runs)
 
 /* Private Texas Hold 'Em Method Definitions
 ********************************************/
-void TexasHoldEm::m_begin_game(GameState gs)
+void TexasHoldEm::m_game_loop(GameState& gs)
+{
+    /**
+     * Play games until the tournament, test game, or MC run is over.
+     *
+     * Each round of a game returns the round that follows it, so games are
+     * played by a loop rather than by each round calling the next.  The same
+     * game state is updated in place throughout, so stack usage does not grow
+     * with the number of games played.
+    */
+    Round round = m_begin_game(gs);
+    while (true)
+    {
+        switch (round)
+        {
+        case Round::Pre_Flop:
+            round = m_pre_flop(gs);
+            break;
+        case Round::Flop:
+            round = m_flop(gs);
+            break;
+        case Round::Turn:
+            round = m_turn(gs);
+            break;
+        case Round::River:
+            round = m_river(gs);
+            break;
+        case Round::Showdown:
+            round = m_showdown(gs);
+            break;
+        case Round::Game_Result:
+            if (!m_end_game(gs)) { return; }
+            round = m_begin_game(gs);
+            break;
+        }
+    }
+}
+
+Round TexasHoldEm::m_begin_game(GameState& gs)
 {
     /**
-     * Begin poker game by
+     * Begin poker game by setting the blinds and dealing the hole cards.
+     *
+     * @return The pre-flop round.
     */
     // Set all (non-eliminated) players to active, and action to No_Action
     for (auto& player : full_player_list)
@@ -183,7 +228,9 @@ void TexasHoldEm::m_begin_game(GameState gs)
     // Deal cards to players
     if (!m_test_game && !m_monte_carlo_game)
     {
-        dealer.shuffle_deck();  // Don't disrupt order of cards if test game
+        // Don't disrupt order of cards if test game
+        dealer.shuffle_deck(StreamRng(random_seed, RngStream::Deck,
+            tournament_number, game_hist.game_number, 0), deal_mode);
         // cout << "Starting game #" << game_hist.game_number << endl;
     }
     dealer.deal_to_players(full_player_list, num_players, m_button_idx);
@@ -200,16 +247,18 @@ void TexasHoldEm::m_begin_game(GameState gs)
         gs.blinds.push_back(full_player_list[i].blind);
         gs.last_actions.push_back(full_player_list[i].prev_action);
         gs.hole_cards.push_back(full_player_list[i].get_hole_cards());
-        gs.best_hands.push_back(full_player_list[i].get_best_hand());
-        gs.hand_ranks.push_back(full_player_list[i].get_best_hand_rank());
+        gs.best_hands.push_back(
+            full_player_list[i].get_best_hand(dealer.board));
+        gs.hand_ranks.push_back(
+            full_player_list[i].get_best_hand_rank(dealer.board));
         gs.remaining_players[i] = !full_player_list[i].is_player_eliminated();
         gs.win_perc.push_back(-1);
     }
     m_update_game_state(gs);
-    m_pre_flop(gs);
+    return Round::Pre_Flop;
 }
 
-void TexasHoldEm::m_pre_flop(GameState gs)
+Round TexasHoldEm::m_pre_flop(GameState& gs)
 {
     /**
      * Start the pre-flop round of betting.
@@ -221,6 +270,8 @@ void TexasHoldEm::m_pre_flop(GameState gs)
      * This is the Under The Gun (UTG) player for more than 3 players and
      * the dealer for three players.
      * For heads-up poker (two players) the dealer/small blind goes first.
+     *
+     * @return The next round to play.
     */
     int starting_player = (m_bb_idx + 1) % initial_num_players;
     gs.player_idx = starting_player;
@@ -238,18 +289,15 @@ void TexasHoldEm::m_pre_flop(GameState gs)
     if (m_get_num_active_not_allin_players() <= 1)
     {
         // Either all other players folded or went all-in, deal all cards
-        dealer.deal_flop(full_player_list);
-        dealer.deal_turn(full_player_list);
-        dealer.deal_river(full_player_list);
-        m_showdown(gs);  // Determine winner of game
-    }
-    else
-    {
-        m_flop(gs);  // Proceed to flop round of betting
+        dealer.deal_flop();
+        dealer.deal_turn();
+        dealer.deal_river();
+        return Round::Showdown;  // Determine winner of game
     }
+    return Round::Flop;  // Proceed to flop round of betting
 }
 
-void TexasHoldEm::m_flop(GameState gs)
+Round TexasHoldEm::m_flop(GameState& gs)
 {
     /**
      * Start the flop round of betting.
@@ -269,22 +317,19 @@ void TexasHoldEm::m_flop(GameState gs)
     gs.raise_player_idx = -1;
     gs.all_in_below_min_raise = false;
     gs.pot_chip_count = pot.get_chip_count();
-    dealer.deal_flop(full_player_list);
+    dealer.deal_flop();
     m_betting_loop(gs, m_sb_idx);
     if (m_get_num_active_not_allin_players() <= 1)
     {
         // Either all other players folded or went all-in, deal all cards
-        dealer.deal_turn(full_player_list);
-        dealer.deal_river(full_player_list);
-        m_showdown(gs);  // Determine winner of game
-    }
-    else
-    {
-        m_turn(gs);  // Proceed to turn round of betting
+        dealer.deal_turn();
+        dealer.deal_river();
+        return Round::Showdown;  // Determine winner of game
     }
+    return Round::Turn;  // Proceed to turn round of betting
 }
 
-void TexasHoldEm::m_turn(GameState gs)
+Round TexasHoldEm::m_turn(GameState& gs)
 {
     /**
      * Start the turn round of betting.
@@ -304,21 +349,18 @@ void TexasHoldEm::m_turn(GameState gs)
     gs.raise_player_idx = -1;
     gs.all_in_below_min_raise = false;
     gs.pot_chip_count = pot.get_chip_count();
-    dealer.deal_turn(full_player_list);
+    dealer.deal_turn();
     m_betting_loop(gs, m_sb_idx);
     if (m_get_num_active_not_allin_players() <= 1)
     {
         // Either all other players folded or went all-in, deal all cards
-        dealer.deal_river(full_player_list);
-        m_showdown(gs);  // Determine winner of game
-    }
-    else
-    {
-        m_river(gs);  // Proceed to river round of betting
+        dealer.deal_river();
+        return Round::Showdown;  // Determine winner of game
     }
+    return Round::River;  // Proceed to river round of betting
 }
 
-void TexasHoldEm::m_river(GameState gs)
+Round TexasHoldEm::m_river(GameState& gs)
 {
     /**
      * Start the river round of betting.
@@ -338,12 +380,12 @@ void TexasHoldEm::m_river(GameState gs)
     gs.raise_player_idx = -1;
     gs.all_in_below_min_raise = false;
     gs.pot_chip_count = pot.get_chip_count();
-    dealer.deal_river(full_player_list);
+    dealer.deal_river();
     m_betting_loop(gs, m_sb_idx);
-    m_showdown(gs);  // Determine winner of game
+    return Round::Showdown;  // Determine winner of game
 }
 
-void TexasHoldEm::m_showdown(GameState gs)
+Round TexasHoldEm::m_showdown(GameState& gs)
 {
     /**
      * Store the best hand of each player who made it to the showdown.
@@ -360,8 +402,8 @@ void TexasHoldEm::m_showdown(GameState gs)
             gs.showdown_players.push_back(
                 ShowdownStruct(
                     player.player_idx,
-                    player.get_best_hand(),
-                    player.get_best_hand_rank(),
+                    player.get_best_hand(dealer.board),
+                    player.get_best_hand_rank(dealer.board),
                     pot.get_total_player_bets(player.player_idx)
                 ));
         }
@@ -369,18 +411,37 @@ void TexasHoldEm::m_showdown(GameState gs)
     gs.num_showdown_players = gs.showdown_players.size();
     game_hist.states.push_back(gs);
     if (debug) { print_state(gs); }
-    m_end_game(gs);
+    return Round::Game_Result;
+}
+
+void TexasHoldEm::m_open_tournament_file()
+{
+    /**
+     * Create the tournament file that completed games are streamed to.
+    */
+    std::filesystem::create_directory("recorded_games/" + get_date());
+    if (tourn_directory != "")
+    {
+        std::filesystem::create_directory("recorded_games/" + get_date() +
+            "/" + tourn_directory);
+    }
+    filename = "recorded_games/" + get_date() + "/" + tourn_directory +
+        "/tourn_" + std::to_string(tournament_number) + "__" +
+        create_timestamp() + ".bin";
+    m_tourn_writer.open(filename, tourn_hist);
 }
 
-void TexasHoldEm::m_end_game(GameState gs)
+bool TexasHoldEm::m_end_game(GameState& gs)
 {
     /**
-     * Determine winner and start the next game or serialize the tournament.
+     * Determine winner and prepare the next game or serialize the tournament.
      *
-     * If more than one player remains return all cards to the deck and start
-     * the next game.  Otherwise, the tournament is concluded and the game
-     * states are serialized and saved to disk.
+     * The completed game is appended to the tournament file.  If more than
+     * one player remains return all cards to the deck and prepare the next
+     * game.  Otherwise, the tournament is concluded and the tournament
+     * results are written to the file header.
      *
+     * @return True if another game should be played.
     */
     gs.round = Round::Game_Result;
     m_determine_game_winner(gs);
@@ -405,14 +466,17 @@ void TexasHoldEm::m_end_game(GameState gs)
     }
     assert((total_chips == MAX_BUY_IN * initial_num_players)
         && "Invalid total chip count!");
-    // Update game state and add to game history.  Add game history to
-    // Tournament history.
+    // Update game state and add to game history.  Stream game history to
+    // the tournament file.
     m_update_game_state(gs);
     game_hist.states.push_back(gs);
     if (debug) { print_state(gs); }
     game_hist.num_states = game_hist.states.size();
-    tourn_hist.games.push_back(game_hist);
-    tourn_hist.num_games = tourn_hist.games.size();
+    tourn_hist.num_games++;
+    if (m_tourn_writer.is_open())
+    {
+        m_tourn_writer.append_game(game_hist);
+    }
     if (num_players == 1 && !(m_test_game || m_monte_carlo_game))
     {
         m_tournament_completed = true;
@@ -420,18 +484,9 @@ void TexasHoldEm::m_end_game(GameState gs)
         int winner_idx = gs.showdown_players[0].player_idx;
         tourn_hist.finishing_order.push_back(winner_idx);
         tourn_hist.game_eliminated.push_back(game_hist.game_number);
-        std::filesystem::create_directory("recorded_games/" + get_date());
-        if (tourn_directory != "")
-        {
-            std::filesystem::create_directory("recorded_games/" + get_date() +
-                "/" + tourn_directory);
-        }
-        filename = "recorded_games/" + get_date() + "/" + tourn_directory +
-            "/tourn_" + std::to_string(tournament_number) + "__" +
-            create_timestamp() + ".bin";
-        write_tournamenthistory(filename, tourn_hist);
+        m_tourn_writer.close(tourn_hist);
         //cout << "Write tournament " << tournament_number << " successful!" << endl;
-        return;
+        return false;
     }
     // All players return their cards
     for (auto& player : full_player_list)
@@ -444,23 +499,21 @@ void TexasHoldEm::m_end_game(GameState gs)
     if (m_test_game)
     {
         m_validate_test_results(gs);
+        return false;
     }
     else if (m_monte_carlo_game)
     {
         // Player 1 is dealt the scenario's cards by the dealer player 0
         if (gs.player_chip_counts[1] > MAX_BUY_IN) { mc_run_wins++; }
         mc_total_runs++;
+        return false;
     }
-    else
-    {
-        m_move_blinds();
-        game_hist.game_number++;
-        game_hist.states.clear();
-        gs.num_showdown_players = 0;
-        gs.showdown_players.clear();
-        m_begin_game(gs);
-    }
-
+    m_move_blinds();
+    game_hist.game_number++;
+    game_hist.states.clear();
+    gs.num_showdown_players = 0;
+    gs.showdown_players.clear();
+    return true;
 }
 
 void TexasHoldEm::m_determine_game_winner(GameState& gs)
@@ -649,6 +702,9 @@ void TexasHoldEm::m_betting_loop(GameState& gs, int starting_plyr)
         {
             m_determine_legal_actions(gs, plyr_idx);
             m_update_game_state(gs);
+            full_player_list[plyr_idx].seed_ai(StreamRng(random_seed,
+                RngStream::Player, tournament_number, gs.game_number,
+                gs.action_number, plyr_idx));
             full_player_list[plyr_idx].player_act(gs);
             m_validate_player_action(gs, plyr_idx);
             // Store game state
@@ -801,7 +857,7 @@ void TexasHoldEm::m_validate_player_action(GameState& gs, int plyr_idx)
         // No change to min bet or min raise
         assert((gs.player_action == Action::Fold) &&
             "Action should be fold!");
-        full_player_list[plyr_idx].fold_player();
+        full_player_list[plyr_idx].fold_player(dealer.board);
     }
     else if ((gs.player_bet == 0) && (gs.chips_to_call == 0))
     {
@@ -1006,21 +1062,22 @@ void TexasHoldEm::m_update_game_state(GameState& gs)
     for (int i = 0; i < initial_num_players; i++)
     {
         gs.last_actions[i] = full_player_list[i].prev_action;
-        gs.best_hands[i] = full_player_list[i].get_best_hand();
-        gs.hand_ranks[i] = full_player_list[i].get_best_hand_rank();
+        gs.best_hands[i] = full_player_list[i].get_best_hand(dealer.board);
+        gs.hand_ranks[i] = full_player_list[i].get_best_hand_rank(dealer.board);
     }
     gs.player_chip_counts = m_get_player_chip_counts();
     gs.num_active_players = m_get_num_active_players();
     gs.remaining_players = m_get_vec_remaining_players();
     gs.active_player_list = m_get_vec_active_players();
-    gs.best_hand = full_player_list[gs.player_idx].get_best_hand();
-    gs.available_cards = full_player_list[gs.player_idx].get_available_cards();
+    gs.best_hand = full_player_list[gs.player_idx].get_best_hand(dealer.board);
+    gs.available_cards =
+        full_player_list[gs.player_idx].get_available_cards(dealer.board);
     // Dealer info
-    gs.flop_card1 = dealer.flop_card1;
-    gs.flop_card2 = dealer.flop_card2;
-    gs.flop_card3 = dealer.flop_card3;
-    gs.turn_card = dealer.turn_card;
-    gs.river_card = dealer.river_card;
+    gs.flop_card1 = dealer.board[0];
+    gs.flop_card2 = dealer.board[1];
+    gs.flop_card3 = dealer.board[2];
+    gs.turn_card = dealer.board[3];
+    gs.river_card = dealer.board[4];
     // Pot info
     gs.pot_chip_count = pot.get_chip_count();
     gs.pot_player_bets = pot.m_player_bets;
@@ -1126,10 +1183,10 @@ vector<unsigned> TexasHoldEm::m_get_player_chip_counts() const
     return chip_counts;
 }
 
-void TexasHoldEm::m_load_script(GameState gs)
+void TexasHoldEm::m_load_script(GameState& gs)
 {
     /**
-     * Load scripted scenario and then begin a single test game.
+     * Load scripted scenario for a single test game.
     */
     PlayerScript& script = m_test_case.player_script;
     dealer.stack_the_deck(script.test_cards);
@@ -1141,10 +1198,9 @@ void TexasHoldEm::m_load_script(GameState gs)
         full_player_list[i].m_chip_count = gs.player_chip_counts[i];
         full_player_list[i].pass_script(script.scripted_actions[i]);
     }
-    m_begin_game(gs);
 }
 
-void TexasHoldEm::m_validate_test_results(GameState gs)
+void TexasHoldEm::m_validate_test_results(GameState& gs)
 {
     /**
      * Compare the final game state to the expected test results.
@@ -0,0 +1,173 @@
+/******************************************************************************
+* Define a work-stealing thread pool.
+******************************************************************************/
+
+/* Headers
+******************************************************************************/
+// C++ standard library
+#include <algorithm>    // For std::max()
+#include <exception>
+#include <functional>
+#include <memory>       // For make_unique
+#include <mutex>
+#include <thread>
+#include <utility>      // For std::move()
+// Project headers
+#include "thread_pool.hpp"
+
+/* Worker Thread State
+******************************************************************************/
+// Pool and deque of the worker running on this thread, if any
+static thread_local const ThreadPool* current_pool = nullptr;
+static thread_local unsigned current_worker = 0;
+
+/* ThreadPool Method Definitions
+******************************************************************************/
+ThreadPool::ThreadPool(unsigned num_threads)
+{
+    num_threads = std::max(num_threads, 1u);
+    for (unsigned i = 0; i < num_threads; i++)
+    {
+        m_queues.push_back(std::make_unique<WorkQueue>());
+    }
+    for (unsigned i = 0; i < num_threads; i++)
+    {
+        m_workers.push_back(std::thread(&ThreadPool::m_work, this, i));
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    /**
+     * Finish every queued task, then stop the workers.
+    */
+    {
+        std::unique_lock<std::mutex> lck(m_mutex);
+        m_done_cv.wait(lck, [this] { return m_unfinished == 0; });
+        m_stop = true;
+    }
+    m_task_cv.notify_all();
+    for (auto& th : m_workers)
+    {
+        th.join();
+    }
+}
+
+unsigned ThreadPool::size() const
+{
+    return static_cast<unsigned>(m_workers.size());
+}
+
+void ThreadPool::submit(std::function<void()> task)
+{
+    /**
+     * Queue a task to be run by one of the workers.
+     *
+     * The shared mutex is only taken when a worker is asleep, so that the
+     * notification cannot slip in between it checking for tasks and waiting.
+    */
+    unsigned queue_idx = current_pool == this ? current_worker :
+        static_cast<unsigned>(m_next_queue++ % m_queues.size());
+    // Count the task before it is visible so the counts never run behind
+    m_unfinished++;
+    m_queued++;
+    {
+        std::lock_guard<std::mutex> lck(m_queues[queue_idx]->mutex);
+        m_queues[queue_idx]->tasks.push_back(std::move(task));
+    }
+    if (m_sleeping > 0)
+    {
+        { std::lock_guard<std::mutex> lck(m_mutex); }
+        m_task_cv.notify_one();
+    }
+}
+
+void ThreadPool::wait()
+{
+    /**
+     * Block until every submitted task has finished.
+     *
+     * Must not be called from a task.  If any task threw an exception, the
+     * first one is rethrown.
+    */
+    std::unique_lock<std::mutex> lck(m_mutex);
+    m_done_cv.wait(lck, [this] { return m_unfinished == 0; });
+    if (m_error)
+    {
+        std::exception_ptr error = m_error;
+        m_error = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+bool ThreadPool::m_take_task(unsigned worker_idx, std::function<void()>& task)
+{
+    /**
+     * Take a task from the back of the worker's own deque, or steal one from
+     * the front of another worker's deque.
+     *
+     * @param worker_idx is the index of the worker's own deque.
+     * @param task is set to the task taken.
+     * @return False if every deque is empty.
+    */
+    const size_t num_queues = m_queues.size();
+    for (size_t i = 0; i < num_queues; i++)
+    {
+        WorkQueue& queue = *m_queues[(worker_idx + i) % num_queues];
+        std::lock_guard<std::mutex> lck(queue.mutex);
+        if (queue.tasks.empty()) { continue; }
+        if (i == 0)
+        {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        }
+        else
+        {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+        m_queued--;
+        return true;
+    }
+    return false;
+}
+
+void ThreadPool::m_work(unsigned worker_idx)
+{
+    /**
+     * Worker thread that runs tasks until the pool is destroyed.
+     *
+     * The worker only sleeps once its own deque and every steal attempt
+     * came up empty.
+    */
+    current_pool = this;
+    current_worker = worker_idx;
+    while (true)
+    {
+        std::function<void()> task;
+        if (!m_take_task(worker_idx, task))
+        {
+            std::unique_lock<std::mutex> lck(m_mutex);
+            m_sleeping++;
+            m_task_cv.wait(lck, [this] { return m_stop || m_queued > 0; });
+            m_sleeping--;
+            if (m_stop && m_queued == 0) { return; }
+            continue;
+        }
+        try
+        {
+            task();
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lck(m_mutex);
+            if (!m_error) { m_error = std::current_exception(); }
+        }
+        if (--m_unfinished == 0)
+        {
+            // Taken so wait() cannot miss the notification
+            { std::lock_guard<std::mutex> lck(m_mutex); }
+            m_done_cv.notify_all();
+        }
+    }
+}
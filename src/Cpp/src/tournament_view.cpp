@@ -0,0 +1,166 @@
+/******************************************************************************
+* Define a memory-mapped, zero-copy reader for recorded tournament files.
+*
+* Only files in the versioned format written by TournamentWriter can be
+* mapped, since their GameStateRecords are fixed size and aligned.
+******************************************************************************/
+
+/* Headers
+******************************************************************************/
+// C++ standard library
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>    // For std::runtime_error
+#include <string>
+#include <vector>
+// POSIX
+#include <fcntl.h>      // For open()
+#include <sys/mman.h>   // For mmap() and munmap()
+#include <sys/stat.h>   // For fstat()
+#include <unistd.h>     // For close()
+// Project headers
+#include "serialize.hpp"
+#include "storage.hpp"
+#include "tournament_view.hpp"
+// Using statements
+using std::string;
+
+/* TournamentView Method Definitions
+******************************************************************************/
+TournamentView::~TournamentView()
+{
+    close();
+}
+
+void TournamentView::close()
+{
+    if (m_data != nullptr)
+    {
+        munmap(const_cast<std::byte*>(m_data), m_size);
+    }
+    m_data = nullptr;
+    m_size = 0;
+    m_game_offsets.clear();
+}
+
+GameView TournamentView::game(size_t idx) const
+{
+    /**
+     * Return a view of game idx without reading any game before it.
+    */
+    assert((idx < m_game_offsets.size()) && "Game index out of range!");
+    const std::byte* record = m_data + m_game_offsets[idx];
+    return GameView(
+        reinterpret_cast<const GameRecordHeader*>(record),
+        reinterpret_cast<const GameStateRecord*>(
+            record + sizeof(GameRecordHeader)));
+}
+
+const TournamentFileHeader& TournamentView::header() const
+{
+    assert(is_open() && "Tournament view is not open!");
+    return *reinterpret_cast<const TournamentFileHeader*>(m_data);
+}
+
+bool TournamentView::is_open() const
+{
+    return m_data != nullptr;
+}
+
+size_t TournamentView::num_games() const
+{
+    return m_game_offsets.size();
+}
+
+bool TournamentView::open(const string& filename)
+{
+    /**
+     * Map a tournament file into memory.
+     *
+     * @param filename is the path of the tournament file.
+     * @return False if the file can't be opened, is not in the versioned
+     *         format, or was written by an incompatible version.  Files that
+     *         end in the middle of a game open with the complete games.
+    */
+    close();
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) { return false; }
+    struct stat st;
+    if (fstat(fd, &st) != 0 ||
+        static_cast<size_t>(st.st_size) < sizeof(TournamentFileHeader))
+    {
+        ::close(fd);
+        return false;
+    }
+    m_size = static_cast<size_t>(st.st_size);
+    void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // The mapping keeps the file open
+    if (data == MAP_FAILED)
+    {
+        m_size = 0;
+        return false;
+    }
+    m_data = static_cast<const std::byte*>(data);
+    bool is_readable = false;
+    try
+    {
+        is_readable = check_tournament_file_header(header());
+    }
+    catch (const std::runtime_error&)
+    {
+        // Versioned, but with a different byte order, version or record size
+    }
+    if (!is_readable)
+    {
+        close();
+        return false;
+    }
+    m_index_games();
+    return true;
+}
+
+void TournamentView::m_index_games()
+{
+    /**
+     * Record the offset of every complete game.
+     *
+     * The offsets are taken from the game index footer.  Files without one,
+     * such as tournaments still being written or interrupted, are indexed by
+     * hopping over the game records, which only touches the small game
+     * record headers and not the states.
+    */
+    const auto* footer = reinterpret_cast<const GameIndexFooter*>(
+        m_data + m_size - sizeof(GameIndexFooter));
+    if (m_size >= sizeof(TournamentFileHeader) + sizeof(GameIndexFooter) &&
+        check_game_index_footer(*footer, header(), m_size))
+    {
+        const auto* entries = reinterpret_cast<const GameIndexEntry*>(
+            m_data + m_size - sizeof(GameIndexFooter) -
+            sizeof(GameIndexEntry) * footer->num_games);
+        for (std::uint64_t i = 0; i < footer->num_games; i++)
+        {
+            if (entries[i].offset + sizeof(GameRecordHeader) +
+                sizeof(GameStateRecord) * entries[i].num_states > m_size)
+            {
+                m_game_offsets.clear();
+                break;
+            }
+            m_game_offsets.push_back(static_cast<size_t>(entries[i].offset));
+        }
+        if (m_game_offsets.size() == footer->num_games) { return; }
+    }
+    // The header's game count is only written at close, so walk the records
+    // until the end of the file or a game that was cut off mid-write
+    size_t offset = sizeof(TournamentFileHeader);
+    while (offset + sizeof(GameRecordHeader) <= m_size)
+    {
+        const auto* record =
+            reinterpret_cast<const GameRecordHeader*>(m_data + offset);
+        if (record->num_states > m_size) { break; }
+        size_t record_size = sizeof(GameRecordHeader) +
+            sizeof(GameStateRecord) * static_cast<size_t>(record->num_states);
+        if (offset + record_size > m_size) { break; }
+        m_game_offsets.push_back(offset);
+        offset += record_size;
+    }
+}
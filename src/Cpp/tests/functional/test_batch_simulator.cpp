@@ -0,0 +1,358 @@
+/******************************************************************************
+* Test functionality of the struct-of-arrays batch simulator.
+******************************************************************************/
+
+/* Headers
+******************************************************************************/
+// C++ standard library
+#include <cassert>
+#include <chrono>       // For high_resolution_clock
+#include <cstdint>
+#include <iostream>
+#include <memory>       // For make_shared
+#include <random>       // For uniform_int_distribution
+#include <span>
+#include <utility>      // For std::to_underlying()
+#include <vector>
+// Project headers
+#include "batch_simulator.hpp"
+#include "cards.hpp"
+#include "constants.hpp"
+#include "inference.hpp"
+#include "random.hpp"
+#include "serialize.hpp"
+#include "storage.hpp"
+#include "test_inference.hpp"
+#include <torch/script.h> // One-stop header.
+// Using statements
+using std::cout;
+using std::endl;
+using std::vector;
+using namespace constants;
+
+/* Test Fixtures
+******************************************************************************/
+bool is_legal(std::uint8_t legal_actions, Action action)
+{
+    for (int i = 0; i < LEGAL_ACTION_COUNT; i++)
+    {
+        if (Legal_Actions[i] == action)
+        {
+            return (legal_actions >> i) & 1;
+        }
+    }
+    return false;
+}
+
+struct PolicyStats
+{
+    bool chips_conserved = true;
+    bool actions_available = true;
+    std::uint64_t num_calls = 0;
+};
+
+BatchPolicy check_call_policy(PolicyStats& stats)
+{
+    /**
+     * Check or call, going all-in when the call takes every chip.
+    */
+    return [&stats](const BatchSimulator& sim, std::span<const int> tables,
+        std::span<BatchAction> actions)
+        {
+            stats.num_calls++;
+            for (size_t i = 0; i < tables.size(); i++)
+            {
+                std::uint8_t legal = sim.legal_actions(tables[i]);
+                if (legal == 0) { stats.actions_available = false; }
+                if (is_legal(legal, Action::Check))
+                {
+                    actions[i].action = Action::Check;
+                }
+                else if (is_legal(legal, Action::Call))
+                {
+                    actions[i].action = Action::Call;
+                }
+                else
+                {
+                    actions[i].action = Action::All_In;
+                }
+            }
+        };
+}
+
+BatchPolicy random_policy(PolicyStats& stats, unsigned starting_stack)
+{
+    /**
+     * Choose a random legal action and a random raise size.
+     *
+     * Each decision draws from its own stream, keyed by table and decision
+     * number, so the choices do not depend on the other tables.
+    */
+    return [&stats, starting_stack](const BatchSimulator& sim,
+        std::span<const int> tables, std::span<BatchAction> actions)
+        {
+            stats.num_calls++;
+            for (size_t i = 0; i < tables.size(); i++)
+            {
+                const int t = tables[i];
+                unsigned chips = sim.pot(t);
+                for (int s = 0; s < sim.num_players(); s++)
+                {
+                    chips += sim.stack(t, s);
+                }
+                if (chips != starting_stack *
+                    static_cast<unsigned>(sim.num_players()))
+                {
+                    stats.chips_conserved = false;
+                }
+                std::uint8_t legal = sim.legal_actions(t);
+                if (legal == 0)
+                {
+                    stats.actions_available = false;
+                    continue;
+                }
+                StreamRng rng(0, RngStream::Player,
+                    static_cast<std::uint64_t>(t), stats.num_calls, 0);
+                vector<Action> choices;
+                for (int a = 0; a < LEGAL_ACTION_COUNT; a++)
+                {
+                    if ((legal >> a) & 1)
+                    {
+                        choices.push_back(Legal_Actions[a]);
+                    }
+                }
+                std::uniform_int_distribution<size_t> pick(
+                    0, choices.size() - 1);
+                actions[i].action = choices[pick(rng)];
+                std::uniform_int_distribution<unsigned> extra(
+                    0, 4 * sim.min_raise(t));
+                actions[i].chips = sim.chips_to_call(t) + sim.min_raise(t) +
+                    extra(rng);
+            }
+        };
+}
+
+vector<std::int64_t> table_winnings(const BatchSimulator& sim, int table)
+{
+    vector<std::int64_t> winnings;
+    for (int s = 0; s < sim.num_players(); s++)
+    {
+        winnings.push_back(sim.winnings(table, s));
+    }
+    return winnings;
+}
+
+bool winnings_sum_to_zero(const BatchSimulator& sim)
+{
+    for (int t = 0; t < sim.num_tables(); t++)
+    {
+        std::int64_t total = 0;
+        for (int s = 0; s < sim.num_players(); s++)
+        {
+            total += sim.winnings(t, s);
+        }
+        if (total != 0) { return false; }
+    }
+    return true;
+}
+
+/* Batch Simulator Functional Tests
+******************************************************************************/
+void test_random_policy(int num_players)
+{
+    cout << endl << "- test_random_policy (" << num_players << " players)..."
+        << endl;
+    // Test Fixtures
+    const int num_tables = 256;
+    const int num_hands = 20;
+    PolicyStats stats;
+    BatchSimulator sim(num_tables, num_players, num_hands, 7);
+    // Execute tests
+    cout << "\t- " << "test every table plays every hand...";
+    sim.run(random_policy(stats, MAX_BUY_IN));
+    assert(sim.is_finished() && "Tables did not finish!");
+    assert((sim.num_hands() ==
+        static_cast<std::uint64_t>(num_tables * num_hands)) &&
+        "Wrong number of hands played!");
+    cout << "\tPASS" << endl;
+    cout << "\t- " << "test chips are conserved...";
+    assert(stats.chips_conserved && "Chips were created or destroyed!");
+    assert(stats.actions_available && "Player to act had no legal action!");
+    assert(winnings_sum_to_zero(sim) && "Winnings do not sum to zero!");
+    cout << "\tPASS" << endl;
+    cout << "\t- " << "test tables do not depend on each other...";
+    PolicyStats single_stats;
+    BatchSimulator single(1, num_players, num_hands, 7);
+    single.run(random_policy(single_stats, MAX_BUY_IN));
+    assert((table_winnings(single, 0) == table_winnings(sim, 0)) &&
+        "Table played different hands alongside other tables!");
+    cout << "\tPASS" << endl;
+}
+
+void test_check_call_policy()
+{
+    cout << endl << "- test_check_call_policy..." << endl;
+    // Test Fixtures
+    const int num_tables = 128;
+    const int num_players = 6;
+    PolicyStats stats;
+    BatchSimulator sim(num_tables, num_players, 10, 3);
+    // Execute tests
+    cout << "\t- " << "test check/call hands reach the river...";
+    sim.run(check_call_policy(stats));
+    assert((sim.is_finished() && stats.actions_available) &&
+        "Tables did not finish!");
+    assert(winnings_sum_to_zero(sim) && "Winnings do not sum to zero!");
+    for (int t = 0; t < num_tables; t++)
+    {
+        assert((sim.board(t).size() == MAX_CARDS_IN_HAND) &&
+            "Board is incomplete!");
+    }
+    cout << "\tPASS" << endl;
+    cout << "\t- " << "test policy is called once per step with every table...";
+    assert((stats.num_calls * num_tables == sim.num_decisions()) &&
+        "Tables did not step in lockstep!");
+    cout << "\tPASS" << endl;
+}
+
+void test_determinism()
+{
+    cout << endl << "- test_determinism..." << endl;
+    // Test Fixtures
+    PolicyStats stats1, stats2;
+    BatchSimulator sim1(64, 9, 10, 11);
+    BatchSimulator sim2(64, 9, 10, 11);
+    // Execute tests
+    cout << "\t- " << "test same seed plays the same hands...";
+    sim1.run(random_policy(stats1, MAX_BUY_IN));
+    sim2.run(random_policy(stats2, MAX_BUY_IN));
+    assert((sim1.num_decisions() == sim2.num_decisions()) &&
+        "Number of decisions differs!");
+    for (int t = 0; t < sim1.num_tables(); t++)
+    {
+        assert((table_winnings(sim1, t) == table_winnings(sim2, t)) &&
+            "Winnings differ!");
+    }
+    cout << "\tPASS" << endl;
+}
+
+void test_encode_batch()
+{
+    cout << endl << "- test_encode_batch..." << endl;
+    // Test Fixtures
+    const int num_tables = 64;
+    const int num_players = 6;
+    PolicyStats stats;
+    BatchPolicy check_call = check_call_policy(stats);
+    BatchSimulator sim(num_tables, num_players, 5, 13);
+    size_t num_rows = 0;
+    // Execute tests
+    cout << "\t- " << "test pending tables encode into one input batch...";
+    sim.run([&](const BatchSimulator& batch, std::span<const int> tables,
+        std::span<BatchAction> actions)
+        {
+            vector<float> inputs(tables.size() * NN_INPUT_SIZE);
+            for (size_t i = 0; i < tables.size(); i++)
+            {
+                encode_nn_inputs(batch.game_state(tables[i]),
+                    inputs.data() + i * NN_INPUT_SIZE);
+            }
+            for (size_t i = 0; i < tables.size(); i++)
+            {
+                const int t = tables[i];
+                const float* row = inputs.data() + i * NN_INPUT_SIZE;
+                const std::uint8_t legal = batch.legal_actions(t);
+                for (int a = 0; a < LEGAL_ACTION_COUNT; a++)
+                {
+                    assert((row[a] == static_cast<float>((legal >> a) & 1)) &&
+                        "Legal actions were encoded wrong!");
+                }
+                Card card = index_to_card(
+                    batch.hole_cards(t, batch.player_to_act(t))[0]);
+                assert((row[7] == static_cast<float>(
+                    std::to_underlying(card.rank) / 14.0)) &&
+                    "Hole cards of another seat were encoded!");
+                const double max_chips = num_players * MAX_BUY_IN;
+                assert((row[44] == static_cast<float>(batch.pot(t) / max_chips)) &&
+                    "Pot was encoded wrong!");
+                assert((row[42] ==
+                    static_cast<float>(batch.chips_to_call(t) / max_chips)) &&
+                    "Chips to call were encoded wrong!");
+            }
+            num_rows += tables.size();
+            check_call(batch, tables, actions);
+        });
+    assert((num_rows == sim.num_decisions()) && "Not every decision encoded!");
+    cout << "\tPASS" << endl;
+}
+
+void test_neural_network_policy()
+{
+    cout << endl << "- test_neural_network_policy..." << endl;
+    // Test Fixtures
+    const int num_tables = 32;
+    auto broker = std::make_shared<InferenceBroker>(echo_module());
+    BatchPolicy policy = neural_network_policy(broker);
+    BatchSimulator sim(num_tables, 4, 5, 17);
+    std::uint64_t num_steps = 0;
+    // Execute tests
+    cout << "\t- " << "test each step is one forward pass of the model...";
+    sim.run([&](const BatchSimulator& batch, std::span<const int> tables,
+        std::span<BatchAction> actions)
+        {
+            num_steps++;
+            policy(batch, tables, actions);
+            for (size_t i = 0; i < tables.size(); i++)
+            {
+                // The echo model prefers the first legal action
+                const std::uint8_t legal = batch.legal_actions(tables[i]);
+                int first = 0;
+                while (!((legal >> first) & 1)) { first++; }
+                assert((actions[i].action == Legal_Actions[first]) &&
+                    "Policy did not play the model's action!");
+            }
+        });
+    assert(sim.is_finished() && "Tables did not finish!");
+    assert(winnings_sum_to_zero(sim) && "Winnings do not sum to zero!");
+    assert((broker->num_batches() == num_steps) &&
+        "Expected one forward pass per step!");
+    cout << "\tPASS" << endl;
+}
+
+void test_throughput()
+{
+    cout << endl << "- test_throughput..." << endl;
+    // Test Fixtures
+    PolicyStats stats;
+    BatchSimulator sim(4096, 6, 10, 5);
+    // Execute tests
+    cout << "\t- " << "test throughput of many tables...";
+    auto t1 = std::chrono::high_resolution_clock::now();
+    sim.run(random_policy(stats, MAX_BUY_IN));
+    auto t2 = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::milli> ms_double = t2 - t1;
+    assert((stats.chips_conserved && winnings_sum_to_zero(sim)) &&
+        "Chips were created or destroyed!");
+    cout << "\tPASS" << endl;
+    cout << "\t- " << sim.num_hands() << " hands and " <<
+        sim.num_decisions() << " decisions in " << stats.num_calls <<
+        " batches:\t" << ms_double.count() << " ms" << endl;
+}
+
+int main()
+{
+    cout << endl << "Beginning tests...\n" << endl;
+    for (int num_players = MIN_PLAYER_COUNT; num_players <= MAX_PLAYER_COUNT;
+        num_players++)
+    {
+        test_random_policy(num_players);
+    }
+    test_check_call_policy();
+    test_determinism();
+    test_encode_batch();
+    test_neural_network_policy();
+    test_throughput();
+    cout << endl << "\nAll tests completed successfully!\n" << endl;
+
+    return 0;
+}
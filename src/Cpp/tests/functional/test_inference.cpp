@@ -0,0 +1,201 @@
+/******************************************************************************
+* Test batching of neural network inference across threads.
+******************************************************************************/
+
+/* Headers
+******************************************************************************/
+// C++ standard library
+#include <cassert>
+#include <chrono>       // For steady_clock
+#include <iostream>
+#include <latch>
+#include <stdexcept>    // For std::runtime_error
+#include <thread>
+#include <utility>      // For std::to_underlying()
+#include <vector>
+// Project headers
+#include "cards.hpp"
+#include "constants.hpp"
+#include "inference.hpp"
+#include "storage.hpp"
+#include "test_inference.hpp"
+#include <torch/script.h> // One-stop header.
+// Using statements
+using std::cout;
+using std::endl;
+using std::vector;
+using namespace constants;
+using namespace std::chrono_literals;
+
+/* Test Fixtures
+******************************************************************************/
+GameState echo_state(int idx)
+{
+    /**
+     * Return a game state whose legal actions and hole cards depend on idx.
+    */
+    GameState gs{};
+    gs.initial_num_players = 2;
+    gs.num_players = 2;
+    gs.num_active_players = 2;
+    gs.player_idx = 0;
+    gs.blinds = { Blind::No_Blind, Blind::No_Blind };
+    gs.hand_ranks = { HandRank::High_Card, HandRank::High_Card };
+    gs.hole_cards.push_back(std::make_pair(
+        Card(Suit::Spade, Card_Ranks[idx % NUMBER_CARDS_IN_SUIT]),
+        Card(Suit::Heart, Rank::Two)));
+    gs.hole_cards.push_back(std::make_pair(Card(), Card()));
+    gs.legal_actions = { Action::Fold,
+        Legal_Actions[idx % LEGAL_ACTION_COUNT] };
+    return gs;
+}
+
+void check_echo(const InferenceResult& result, int idx)
+{
+    for (int i = 0; i < LEGAL_ACTION_COUNT; i++)
+    {
+        bool legal = Legal_Actions[i] == Action::Fold ||
+            Legal_Actions[i] == Legal_Actions[idx % LEGAL_ACTION_COUNT];
+        assert((result.action_logits[i] == (legal ? 1.0f : 0.0f)) &&
+            "Result belongs to another request!");
+    }
+    float rank = static_cast<float>(
+        std::to_underlying(Card_Ranks[idx % NUMBER_CARDS_IN_SUIT]) / 14.0);
+    assert((result.bet == rank) && "Result belongs to another request!");
+}
+
+/* InferenceBroker Functional Tests
+******************************************************************************/
+void test_registered_callers()
+{
+    cout << endl << "- test_registered_callers..." << endl;
+    // Test Fixtures
+    constexpr int num_callers = 6;
+    InferenceBroker broker(echo_module(), INFERENCE_MAX_BATCH_SIZE, 10s);
+    std::latch registered(num_callers);
+    vector<std::thread> callers;
+    // Execute tests
+    cout << "\t- " << "test batch is sent when every caller is waiting...";
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < num_callers; i++)
+    {
+        callers.push_back(std::thread([i, &broker, &registered]
+            {
+                broker.add_caller();
+                registered.arrive_and_wait();
+                GameState gs = echo_state(i);
+                check_echo(broker.infer(gs), i);
+                broker.remove_caller(std::this_thread::get_id());
+            }));
+    }
+    for (auto& th : callers)
+    {
+        th.join();
+    }
+    assert((std::chrono::steady_clock::now() - start < 5s) &&
+        "Batch waited for more callers than are registered!");
+    assert((broker.num_batches() == 1) &&
+        "Every caller should share one forward pass!");
+    cout << "\tPASS" << endl;
+}
+
+void test_single_caller()
+{
+    cout << endl << "- test_single_caller..." << endl;
+    // Test Fixtures
+    InferenceBroker broker(echo_module(), INFERENCE_MAX_BATCH_SIZE, 10s);
+    broker.add_caller();
+    // Execute tests
+    cout << "\t- " << "test one registered caller never waits for a batch...";
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 20; i++)
+    {
+        GameState gs = echo_state(i);
+        check_echo(broker.infer(gs), i);
+    }
+    assert((std::chrono::steady_clock::now() - start < 5s) &&
+        "Single caller waited for a full batch!");
+    assert((broker.num_batches() == 20) && "Expected one batch per request!");
+    broker.remove_caller(std::this_thread::get_id());
+    cout << "\tPASS" << endl;
+}
+
+void test_max_wait()
+{
+    cout << endl << "- test_max_wait..." << endl;
+    // Test Fixtures
+    const auto max_wait = 100ms;
+    InferenceBroker broker(echo_module(), INFERENCE_MAX_BATCH_SIZE, max_wait);
+    // Execute tests
+    cout << "\t- " << "test unregistered caller is answered after max wait...";
+    auto start = std::chrono::steady_clock::now();
+    GameState gs = echo_state(3);
+    check_echo(broker.infer(gs), 3);
+    assert((std::chrono::steady_clock::now() - start >= max_wait) &&
+        "Partial batch was sent before max wait!");
+    assert((broker.num_batches() == 1) && "Expected a single batch!");
+    cout << "\tPASS" << endl;
+}
+
+void test_model_error()
+{
+    cout << endl << "- test_model_error..." << endl;
+    // Test Fixtures
+    torch::jit::script::Module no_forward("no_forward");
+    InferenceBroker broker(no_forward, INFERENCE_MAX_BATCH_SIZE, 1ms);
+    GameState gs = echo_state(0);
+    // Execute tests
+    cout << "\t- " << "test model errors are rethrown to every caller...";
+    for (int i = 0; i < 2; i++)
+    {
+        bool threw = false;
+        try
+        {
+            broker.infer(gs);
+        }
+        catch (const std::runtime_error&)
+        {
+            threw = true;
+        }
+        assert(threw && "Model error was not rethrown!");
+    }
+    cout << "\tPASS" << endl;
+}
+
+void test_model_registry()
+{
+    cout << endl << "- test_model_registry..." << endl;
+    // Test Fixtures
+    ModelRegistry registry;
+    registry.add("missing", "missing_model.pt");
+    // Execute tests
+    cout << "\t- " << "test failed loads are reported and not cached...";
+    for (int i = 0; i < 2; i++)
+    {
+        bool threw = false;
+        try
+        {
+            registry.get("missing");
+        }
+        catch (const std::runtime_error&)
+        {
+            threw = true;
+        }
+        assert(threw && "Model load failure was not reported!");
+        assert(!registry.is_loaded("missing") && "Failed load was cached!");
+    }
+    cout << "\tPASS" << endl;
+}
+
+int main()
+{
+    cout << endl << "Beginning tests...\n" << endl;
+    test_registered_callers();
+    test_single_caller();
+    test_max_wait();
+    test_model_error();
+    test_model_registry();
+    cout << endl << "\nAll tests completed successfully!\n" << endl;
+
+    return 0;
+}
@@ -5,6 +5,8 @@
 /* Headers
 ******************************************************************************/
 // C++ standard library
+#include <cmath>        // For std::abs()
+#include <cstdio>       // For std::remove()
 #include <iomanip>      // For std::fixed and std::setprecision()
 #include <string>
 // Project headers
@@ -50,6 +52,162 @@ void test_ak_suited()
     );
 }
 
+void test_preflop_equity_table()
+{
+    cout << endl << endl << "- test_preflop_equity_table..." << endl;
+    // Test Fixtures
+    Card ace_diamond(Suit::Diamond, Rank::Ace);
+    Card ace_spade(Suit::Spade, Rank::Ace);
+    Card king_diamond(Suit::Diamond, Rank::King);
+    Card seven_club(Suit::Club, Rank::Seven);
+    Card two_heart(Suit::Heart, Rank::Two);
+    string filename = "preflop_equity_test.bin";
+    // Execute tests
+    cout << "\t- " << "test hole card classes...";
+    vector<int> seen_classes(NUM_HOLE_CARD_CLASSES, 0);
+    for (int i = 0; i < NUM_HOLE_CARD_CLASSES; i++)
+    {
+        auto [c1, c2] = hole_card_class_example(i);
+        assert((hole_card_class(c1, c2) == i) && "Class does not round trip!");
+        assert((hole_card_class(c2, c1) == i) && "Class depends on order!");
+        seen_classes[i]++;
+    }
+    assert((hole_card_class(ace_diamond, king_diamond) !=
+        hole_card_class(ace_spade, king_diamond)) &&
+        "Suited and unsuited hands must differ!");
+    cout << "\t\t\tPASS" << endl;
+    cout << "\t- " << "test table is independent of thread count...";
+    auto t1 = std::chrono::high_resolution_clock::now();
+    PreflopEquityTable table = generate_preflop_equity_table(200, 0, 4);
+    auto t2 = std::chrono::high_resolution_clock::now();
+    PreflopEquityTable serial_table = generate_preflop_equity_table(200, 0, 1);
+    for (int i = 0; i < NUM_HOLE_CARD_CLASSES; i++)
+    {
+        for (int n = MIN_PLAYER_COUNT; n <= MAX_PLAYER_COUNT; n++)
+        {
+            assert((table.equity(i, n) == serial_table.equity(i, n)) &&
+                "Table depends on number of threads!");
+        }
+    }
+    cout << "\tPASS" << endl;
+    cout << "\t- " << "test pocket aces beat seven deuce...";
+    for (int n = MIN_PLAYER_COUNT; n <= MAX_PLAYER_COUNT; n++)
+    {
+        assert((table.equity(ace_diamond, ace_spade, n) >
+            table.equity(seven_club, two_heart, n)) &&
+            "Pocket aces should have more equity than seven deuce!");
+    }
+    cout << "\t\tPASS" << endl;
+    cout << "\t- " << "test save and load table...";
+    table.save(filename);
+    PreflopEquityTable loaded_table;
+    assert((loaded_table.load(filename)) && "Failed to load table!");
+    std::remove(filename.c_str());
+    assert((loaded_table.num_runs == table.num_runs) && "Runs do not match!");
+    for (int i = 0; i < NUM_HOLE_CARD_CLASSES; i++)
+    {
+        for (int n = MIN_PLAYER_COUNT; n <= MAX_PLAYER_COUNT; n++)
+        {
+            assert((loaded_table.equity(i, n) == table.equity(i, n)) &&
+                "Loaded table does not match saved table!");
+        }
+    }
+    cout << "\t\t\tPASS" << endl;
+    std::chrono::duration<double, std::milli> ms_double = t2 - t1;
+    cout << "\t- Pocket aces heads-up equity:\t" << std::fixed <<
+        std::setprecision(2) <<
+        table.equity(ace_diamond, ace_spade, 2) * 100 << "%" << endl;
+    cout << "\t- Generation time (200 runs):\t" << ms_double.count() <<
+        " ms" << endl;
+}
+
+void test_flop_equity_cache()
+{
+    cout << endl << endl << "- test_flop_equity_cache..." << endl;
+    // Test Fixtures
+    std::pair<Card, Card> hole1(
+        Card(Suit::Spade, Rank::Ace), Card(Suit::Heart, Rank::King));
+    vector<Card> board1{ Card(Suit::Spade, Rank::Nine),
+        Card(Suit::Spade, Rank::Seven), Card(Suit::Club, Rank::Jack) };
+    // Same situation with suits relabelled and cards reordered
+    std::pair<Card, Card> hole2(
+        Card(Suit::Club, Rank::King), Card(Suit::Diamond, Rank::Ace));
+    vector<Card> board2{ Card(Suit::Heart, Rank::Jack),
+        Card(Suit::Diamond, Rank::Seven), Card(Suit::Diamond, Rank::Nine) };
+    // Different situation: the king now matches the flush draw suit
+    std::pair<Card, Card> hole3(
+        Card(Suit::Heart, Rank::Ace), Card(Suit::Spade, Rank::King));
+    vector<Card> board3 = board1;
+    // Execute tests
+    cout << "\t- " << "test suit-isomorphic situations share a key...";
+    canonicalize_suits(hole1, board1);
+    canonicalize_suits(hole2, board2);
+    canonicalize_suits(hole3, board3);
+    std::uint64_t key1 = equity_cache_key(hole1, board1, 3, 1000);
+    std::uint64_t key2 = equity_cache_key(hole2, board2, 3, 1000);
+    std::uint64_t key3 = equity_cache_key(hole3, board3, 3, 1000);
+    assert((key1 == key2) && "Isomorphic situations have different keys!");
+    assert((key1 != key3) && "Different situations have the same key!");
+    assert((key1 != equity_cache_key(hole1, board1, 2, 1000)) &&
+        "Key does not depend on number of opponents!");
+    cout << "\tPASS" << endl;
+    cout << "\t- " << "test cache hits and misses...";
+    EquityCache cache(2);
+    double equity = 0;
+    assert((!cache.lookup(key1, equity)) && "Empty cache should miss!");
+    cache.insert(key1, 0.25);
+    assert((cache.lookup(key2, equity) && equity == 0.25) &&
+        "Cache should hit!");
+    assert((cache.hits() == 1 && cache.misses() == 1) &&
+        "Incorrect hit and miss counts!");
+    cout << "\t\t\tPASS" << endl;
+    cout << "\t- " << "test cache is bounded...";
+    cache.insert(key3, 0.5);
+    cache.insert(equity_cache_key(hole1, board1, 2, 1000), 0.75);
+    assert((cache.size() == 2) && "Cache exceeded its capacity!");
+    assert((!cache.lookup(key1, equity)) &&
+        "Least recently used entry should be evicted!");
+    cout << "\t\t\tPASS" << endl;
+}
+
+void test_parallel_equity()
+{
+    cout << endl << endl << "- test_parallel_equity..." << endl;
+    // Test Fixtures
+    std::pair<Card, Card> hole_cards(
+        Card(Suit::Spade, Rank::Ace), Card(Suit::Heart, Rank::King));
+    vector<Card> board{ Card(Suit::Spade, Rank::Nine),
+        Card(Suit::Spade, Rank::Seven), Card(Suit::Club, Rank::Jack) };
+    ThreadPool one_worker(1);
+    ThreadPool three_workers(3);
+    // Execute tests
+    cout << "\t- " << "test result does not depend on thread count...";
+    EquityResult result0 = sample_equity(
+        hole_cards, board, 3, 10000, StreamRng(42), nullptr);
+    EquityResult result1 = sample_equity(
+        hole_cards, board, 3, 10000, StreamRng(42), &one_worker);
+    EquityResult result3 = sample_equity(
+        hole_cards, board, 3, 10000, StreamRng(42), &three_workers);
+    assert((result1.num_runs == 10000) && "Runs were lost when merging!");
+    assert((result0.wins == result1.wins && result0.ties == result1.ties &&
+        result0.tie_share == result1.tie_share) &&
+        "Parallel equity depends on the number of threads!");
+    assert((result1.wins == result3.wins && result1.ties == result3.ties &&
+        result1.tie_share == result3.tie_share) &&
+        "Parallel equity depends on the number of threads!");
+    EquityResult other_seed = sample_equity(
+        hole_cards, board, 3, 10000, StreamRng(43), &three_workers);
+    assert((other_seed.wins != result1.wins) &&
+        "Parallel equity does not depend on the seed!");
+    cout << "\tPASS" << endl;
+    cout << "\t- " << "test parallel and serial equity agree...";
+    std::mt19937 rng(42);
+    EquityResult serial = sample_equity(hole_cards, board, 3, 10000, rng);
+    assert((std::abs(serial.equity() - result3.equity()) < 0.03) &&
+        "Parallel and serial equity differ!");
+    cout << "\t\tPASS" << endl;
+}
+
 int main()
 {
     cout << endl << "Beginning tests...\n" << endl;
@@ -60,6 +218,15 @@ int main()
     execute_test(test_royal_flush_10player());
     execute_test(test_straight_draw_4player_1000runs());
     execute_test(test_straight_draw_4player_10000runs());
+    execute_equity_test(test_flop_4player1());
+    execute_equity_test(test_flop_4player2());
+    execute_equity_test(test_royal_flush_10player());
+    execute_equity_test(test_straight_draw_4player_10000runs());
+    execute_equity_test(test_straight_draw_turn_2player());
+    execute_equity_test(test_missed_draw_river_2player());
+    test_preflop_equity_table();
+    test_flop_equity_cache();
+    test_parallel_equity();
     cout << endl << "\nAll tests completed successfully!\n" << endl;
     return 0;
 }
\ No newline at end of file
@@ -5,7 +5,6 @@
 /* Headers
 ******************************************************************************/
 // C++ standard library
-#include <condition_variable>
 #include <chrono>       // For high_resolution_clock
 #include <filesystem>
 #include <iostream>
@@ -20,6 +19,7 @@
 #include "player.hpp"
 #include "serialize.hpp"
 #include "texasholdem.hpp"
+#include "thread_pool.hpp"
 // Using statements
 using std::cout;
 using std::endl;
@@ -28,10 +28,7 @@ using namespace constants;
 
 /* Playback Functional Tests
 ******************************************************************************/
-std::mutex thread_count_mutex;
-std::condition_variable thread_cv;
-unsigned thread_count = 0;
-unsigned max_threads;
+std::mutex cout_mutex;
 
 struct the_data
 {
@@ -60,7 +57,7 @@ struct the_data
     vector<AI_Type> player_ai_types;
 };
 
-void run_tournament(int thread_index, the_data data)
+void run_tournament(int thread_index, const the_data& data)
 {
     TexasHoldEm the(
         data.player_ai_types,
@@ -72,11 +69,8 @@ void run_tournament(int thread_index, the_data data)
         data.tourn_directory
     );
     the.begin_tournament();
-    std::unique_lock<std::mutex> lck(thread_count_mutex);
-    thread_count--;
+    std::lock_guard<std::mutex> lck(cout_mutex);
     cout << "Tournament " << thread_index << " completed!" << endl;
-    lck.unlock();
-    thread_cv.notify_one();
 }
 
 int main()
@@ -84,10 +78,9 @@ int main()
     // Multithreading options
     int num_tourns = 20;
     const unsigned processor_count = std::thread::hardware_concurrency();
-    max_threads = processor_count / 2 - 4;
+    const unsigned max_threads = processor_count;
     cout << processor_count << endl;
     cout << max_threads << endl;
-    vector<std::thread> threads(num_tourns);
     // THE constructor arguments
     int num_players = 10;
     vector<AI_Type> player_ai_types;
@@ -101,22 +94,13 @@ int main()
         tourn_directory
     );
     // Instantiate THE object and begin tournament
-    std::unique_lock<std::mutex> lck(thread_count_mutex);
     auto t1 = std::chrono::high_resolution_clock::now();
+    ThreadPool pool(max_threads);
     for (int i = 0; i < num_tourns; i++)
     {
-        threads[i] = std::thread(run_tournament, i, data);
-        thread_count++;
-        if (thread_count == max_threads)
-        {
-            thread_cv.wait(lck, [] { return thread_count < max_threads; });
-        }
-    }
-    lck.unlock();
-    for (auto& th : threads)
-    {
-        th.join();
+        pool.submit([i, &data] { run_tournament(i, data); });
     }
+    pool.wait();
     auto t2 = std::chrono::high_resolution_clock::now();
     std::chrono::duration<double, std::milli> ms_double = t2 - t1;
     std::cout << "\n\t- Execution time of " << max_threads << " cores:\t\t" <<
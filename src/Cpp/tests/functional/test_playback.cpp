@@ -7,10 +7,12 @@
 // C++ standard library
 #include <iostream>
 #include <string>
+#include <thread>
 #include <vector>
 // Project headers
 #include "cards.hpp"
 #include "constants.hpp"
+#include "equity.hpp"
 #include "playback.hpp"
 #include "player.hpp"
 #include "serialize.hpp"
@@ -45,6 +47,8 @@ int main()
     int seed = 72;
     int tournament_num = seed;
     bool debug = false;
+    // Only one table is played, so let each decision use every core
+    set_equity_threads(std::thread::hardware_concurrency());
     // Instantiate THE object and begin tournament
     TexasHoldEm the(
         player_ai_types,
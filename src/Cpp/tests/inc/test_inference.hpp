@@ -0,0 +1,28 @@
+#pragma once
+
+/******************************************************************************
+* Store test fixtures for neural network inference testing.
+******************************************************************************/
+
+/* Headers
+******************************************************************************/
+#include <torch/script.h> // One-stop header.
+
+/* Helper Functions
+******************************************************************************/
+torch::jit::script::Module echo_module()
+{
+    /**
+     * Return a model that echoes its inputs back as its outputs.
+     *
+     * The action logits are the legal action inputs and the bet is the rank
+     * input of the first hole card, so every caller can check that it got
+     * the results of its own row of the batch.
+    */
+    torch::jit::script::Module module("echo");
+    module.define(R"JIT(
+        def forward(self, x):
+            return x[:, 0:7], x[:, 7]
+    )JIT");
+    return module;
+}
@@ -15,7 +15,9 @@
 // Project headers
 #include "cards.hpp"
 #include "constants.hpp"
+#include "equity.hpp"
 #include "player.hpp"
+#include "preflop.hpp"
 #include "storage.hpp"
 #include "texasholdem.hpp"
 
@@ -75,6 +77,45 @@ void execute_test(const T test)
     }
 }
 
+template <typename T>
+void execute_equity_test(const T test)
+{
+    std::mt19937 rng(test.seed);
+    std::pair<Card, Card> hole_cards(test.starting_hand[0], test.starting_hand[1]);
+    std::vector<Card> board(test.starting_hand.begin() + 2, test.starting_hand.end());
+    // Time execution of test
+    auto t1 = std::chrono::high_resolution_clock::now();
+    EquityResult result = calculate_equity(
+        hole_cards,
+        board,
+        test.num_players - 1,
+        static_cast<int>(test.num_runs),
+        rng);
+    auto t2 = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::milli> ms_double = t2 - t1;
+    // Print output
+    std::cout << "\n\n" << "equity_" << test.test_desc << std::endl;
+    std::cout << "\t- Number of players:\t\t" << test.num_players << std::endl;
+    std::cout << "\t- Number games played:\t\t" << result.num_runs << std::endl;
+    std::cout << "\t- Number games won:\t\t" << result.wins << std::endl;
+    std::cout << "\t- Number games tied:\t\t" << result.ties << std::endl;
+    std::cout << std::fixed;
+    std::cout << std::setprecision(2);
+    double prob = result.equity() * 100;
+    std::cout << "\t- Equity:\t\t\t" << prob << "%" << std::endl;
+    std::cout << "\t- Exact enumeration:\t\t" << std::boolalpha <<
+        result.exact << std::endl;
+    std::cout << "\t- Execution time:\t\t" << ms_double.count() << " ms\n";
+    if (test.min_prob >= 0)
+    {
+        assert((prob >= test.min_prob) && "Simulated equity too low!");
+    }
+    if (test.max_prob >= 0)
+    {
+        assert((prob <= test.max_prob) && "Simulated equity too high!");
+    }
+}
+
 /* Test Fixtures
 ******************************************************************************/
 struct test_pocket_cards_struct
@@ -216,4 +257,50 @@ struct test_straight_draw_4player_10000runs
     };
     double max_prob = -1;
     double min_prob = -1;
-};
\ No newline at end of file
+};
+struct test_straight_draw_turn_2player
+{
+    std::string test_desc = "test_straight_draw_turn_2player...";
+    int seed = 0;
+    int num_players = 2;
+    size_t num_runs = 1000;
+    std::vector<Card> starting_hand = {
+    // Hole cards
+    Card(constants::Suit::Spade, constants::Rank::Jack),
+    Card(constants::Suit::Spade, constants::Rank::Queen),
+    // Flop cards
+    Card(constants::Suit::Diamond, constants::Rank::Ten),
+    Card(constants::Suit::Spade, constants::Rank::Seven),
+    Card(constants::Suit::Club, constants::Rank::King),
+    // Turn Card
+    Card(constants::Suit::Heart, constants::Rank::Two),
+    // River Card
+    };
+    // Exact equity is 49.61%
+    double max_prob = 49.62;
+    double min_prob = 49.61;
+};
+
+struct test_missed_draw_river_2player
+{
+    std::string test_desc = "test_missed_draw_river_2player...";
+    int seed = 0;
+    int num_players = 2;
+    size_t num_runs = 1000;
+    std::vector<Card> starting_hand = {
+    // Hole cards
+    Card(constants::Suit::Spade, constants::Rank::Jack),
+    Card(constants::Suit::Spade, constants::Rank::Queen),
+    // Flop cards
+    Card(constants::Suit::Diamond, constants::Rank::Ten),
+    Card(constants::Suit::Spade, constants::Rank::Seven),
+    Card(constants::Suit::Club, constants::Rank::King),
+    // Turn Card
+    Card(constants::Suit::Heart, constants::Rank::Two),
+    // River Card
+    Card(constants::Suit::Heart, constants::Rank::Four),
+    };
+    // Exact equity is 28.74%
+    double max_prob = 28.74;
+    double min_prob = 28.73;
+};
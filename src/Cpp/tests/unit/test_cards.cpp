@@ -9,11 +9,14 @@
 #include <cassert>
 #include <iostream>
 #include <map>
+#include <random>
 #include <span>
+#include <utility>  // For std::pair
 #include <vector>
 // Project headers
 #include "cards.hpp"
 #include "constants.hpp"
+#include "evaluator.hpp"
 // Using statements
 using std::array;
 using std::cout;
@@ -660,6 +663,267 @@ void test_high_card()
     hand_assert(cards5, correct_hand, correct_hand_rank);
 }
 
+/* Hand Evaluator Tests
+******************************************************************************/
+void test_hand_strength_order()
+{
+    cout << endl << "- test_hand_strength_order..." << endl;
+    // Test Fixtures
+    vector<Card> wheel_straight_flush{
+        Card(Suit::Spade, Rank::Ace),
+        Card(Suit::Spade, Rank::Two),
+        Card(Suit::Spade, Rank::Three),
+        Card(Suit::Spade, Rank::Four),
+        Card(Suit::Spade, Rank::Five)
+    };
+    vector<Card> four_of_a_kind{
+        Card(Suit::Spade, Rank::King),
+        Card(Suit::Heart, Rank::King),
+        Card(Suit::Diamond, Rank::King),
+        Card(Suit::Club, Rank::King),
+        Card(Suit::Spade, Rank::Queen)
+    };
+    vector<Card> flush{
+        Card(Suit::Heart, Rank::Ace),
+        Card(Suit::Heart, Rank::Jack),
+        Card(Suit::Heart, Rank::Nine),
+        Card(Suit::Heart, Rank::Four),
+        Card(Suit::Heart, Rank::Two)
+    };
+    vector<Card> pair_high_kicker{
+        Card(Suit::Heart, Rank::Eight),
+        Card(Suit::Club, Rank::Eight),
+        Card(Suit::Spade, Rank::Ace),
+        Card(Suit::Diamond, Rank::Six),
+        Card(Suit::Heart, Rank::Three)
+    };
+    vector<Card> pair_low_kicker{
+        Card(Suit::Spade, Rank::Eight),
+        Card(Suit::Diamond, Rank::Eight),
+        Card(Suit::Club, Rank::King),
+        Card(Suit::Club, Rank::Queen),
+        Card(Suit::Spade, Rank::Jack)
+    };
+    vector<Card> pair_tie{
+        Card(Suit::Diamond, Rank::Eight),
+        Card(Suit::Spade, Rank::Eight),
+        Card(Suit::Club, Rank::Ace),
+        Card(Suit::Spade, Rank::Six),
+        Card(Suit::Spade, Rank::Three)
+    };
+    // Execute tests
+    cout << "\t- " << "test wheel straight flush beats flush...";
+    assert((evaluate_hand(wheel_straight_flush).key > evaluate_hand(flush).key)
+        && "Wheel straight flush should beat a flush!");
+    assert((evaluate_hand(wheel_straight_flush).key >
+        evaluate_hand(four_of_a_kind).key) &&
+        "Wheel straight flush should beat four of a kind!");
+    cout << "\t\tPASS" << endl;
+    cout << "\t- " << "test kicker breaks tie...";
+    assert((evaluate_hand(pair_high_kicker).key >
+        evaluate_hand(pair_low_kicker).key) &&
+        "Higher kicker should win!");
+    cout << "\t\t\tPASS" << endl;
+    cout << "\t- " << "test equal hands tie...";
+    assert((evaluate_hand(pair_high_kicker).key ==
+        evaluate_hand(pair_tie).key) && "Equal hands should tie!");
+    cout << "\t\t\tPASS" << endl;
+}
+
+void test_random_seven_card_hands()
+{
+    cout << endl << "- test_random_seven_card_hands..." << endl;
+    // Test Fixtures
+    Deck deck(StreamRng(1234));
+    constexpr int num_hands = 20000;
+    // Execute tests
+    cout << "\t- " << "test best hand is best five card subset...";
+    for (int n = 0; n < num_hands; n++)
+    {
+        deck.shuffle_deck();
+        vector<Card> cards;
+        for (int i = 0; i < 7; i++) { cards.push_back(deck.deal_one_card()); }
+        std::uint32_t seven_card_key = evaluate_hand(cards).key;
+        std::uint32_t best_subset_key = 0;
+        for (int skip1 = 0; skip1 < 7; skip1++)
+        {
+            for (int skip2 = skip1 + 1; skip2 < 7; skip2++)
+            {
+                vector<Card> subset;
+                for (int i = 0; i < 7; i++)
+                {
+                    if (i != skip1 && i != skip2) { subset.push_back(cards[i]); }
+                }
+                best_subset_key = std::max(best_subset_key,
+                    evaluate_hand(subset).key);
+            }
+        }
+        assert((seven_card_key == best_subset_key) &&
+            "Seven card strength does not match best five card subset!");
+        Hand hand;
+        for (const auto& c : cards) { hand.add_card(c); }
+        hand.determine_best_hand();
+        assert((hand_strength_key(hand.best_hand) == seven_card_key) &&
+            "Best hand does not match hand strength!");
+    }
+    cout << "\tPASS" << endl;
+}
+
+void test_card_index()
+{
+    cout << endl << "- test_card_index..." << endl;
+    // Test Fixtures
+    Deck deck(StreamRng(1357));
+    // Execute tests
+    cout << "\t- " << "test every card has a unique compact index...";
+    CardMask seen;
+    for (int idx = 0; idx < NUMBER_CARDS_IN_DECK; idx++)
+    {
+        Card c = index_to_card(idx);
+        assert((card_index(c) == idx) && "Card index does not round trip!");
+        assert((!seen.contains(c)) && "Two indices map to the same card!");
+        seen.add_card(c);
+        CardMask mask;
+        mask.add_card_index(idx);
+        assert((mask.contains(c)) && "Card mask index does not match card!");
+    }
+    assert((card_index(Card()) == NO_CARD_INDEX) &&
+        "Blank card has the wrong index!");
+    assert((index_to_card(NO_CARD_INDEX) == Card()) &&
+        "Blank card index does not round trip!");
+    cout << "\tPASS" << endl;
+    cout << "\t- " << "test partial shuffle deals distinct cards...";
+    for (int n = 0; n < 1000; n++)
+    {
+        int num_cards = n % (NUMBER_CARDS_IN_DECK + 1);
+        deck.shuffle_deck(num_cards);
+        CardMask dealt;
+        for (int i = 0; i < num_cards; i++)
+        {
+            Card c = deck.deal_one_card();
+            assert((!dealt.contains(c)) && "Card was dealt twice!");
+            dealt.add_card(c);
+        }
+    }
+    cout << "\tPASS" << endl;
+}
+
+void test_lazy_deal()
+{
+    cout << endl << "- test_lazy_deal..." << endl;
+    // Test Fixtures
+    Deck deck1;
+    Deck deck2;
+    // Execute tests
+    cout << "\t- " << "test lazy deal is distinct and reproducible...";
+    for (int n = 0; n < 1000; n++)
+    {
+        // The second deck is left in a different order by a full shuffle
+        deck2.rng = StreamRng(n + 1);
+        deck2.shuffle_deck();
+        deck1.rng = StreamRng(n);
+        deck2.rng = StreamRng(n);
+        deck1.shuffle_deck(DealMode::Lazy);
+        deck2.shuffle_deck(DealMode::Lazy);
+        CardMask dealt;
+        for (int i = 0; i < NUMBER_CARDS_IN_DECK; i++)
+        {
+            if (i % 7 == 0) { deck1.burn_one_card(); }
+            Card c = deck1.deal_one_card();
+            assert((!dealt.contains(c)) && "Card was dealt twice!");
+            assert((c == deck2.deal_one_card()) &&
+                "Lazy deal depends on more than the random number stream!");
+            dealt.add_card(c);
+        }
+    }
+    cout << "\tPASS" << endl;
+}
+
+void test_board_prefix_hand()
+{
+    cout << endl << "- test_board_prefix_hand..." << endl;
+    // Test Fixtures
+    Deck deck(StreamRng(2468));
+    constexpr int num_hands = 2000;
+    // Execute tests
+    cout << "\t- " << "test board prefixes match the cards dealt...";
+    for (int n = 0; n < num_hands; n++)
+    {
+        deck.shuffle_deck();
+        Card hole1 = deck.deal_one_card();
+        Card hole2 = deck.deal_one_card();
+        Board board;
+        for (int i = 0; i < MAX_CARDS_IN_HAND; i++)
+        {
+            board.add_card(deck.deal_one_card());
+        }
+        // Evaluate every street from the full board, as a player who folded
+        // earlier in the hand would be
+        for (size_t num_board = 0; num_board <= board.size(); num_board++)
+        {
+            vector<Card> cards{ hole1, hole2 };
+            for (size_t i = 0; i < num_board; i++) { cards.push_back(board[i]); }
+            CardMask mask = board.card_mask(num_board);
+            for (size_t i = 0; i < board.size(); i++)
+            {
+                assert((mask.contains(board[i]) == (i < num_board)) &&
+                    "Board prefix has the wrong cards!");
+            }
+            mask.add_card(hole1);
+            mask.add_card(hole2);
+            HandStrength strength = evaluate_hand(mask);
+            assert((strength.key == evaluate_hand(cards).key) &&
+                "Board prefix does not match the cards dealt!");
+            Hand hand;
+            for (const auto& c : cards) { hand.add_card(c); }
+            hand.determine_best_hand();
+            array<Card, MAX_CARDS_IN_HAND> best_hand =
+                select_best_hand(cards, strength);
+            for (int i = 0; i < MAX_CARDS_IN_HAND; i++)
+            {
+                assert((best_hand[i] == hand.best_hand[i]) &&
+                    "Best hand depends on the order the cards were dealt!");
+            }
+        }
+    }
+    cout << "\tPASS" << endl;
+}
+
+void test_batch_evaluation()
+{
+    cout << endl << "- test_batch_evaluation..." << endl;
+    // Test Fixtures
+    Deck deck(StreamRng(4321));
+    constexpr int num_boards = 20000;
+    constexpr int num_hands = 9;  // Not a multiple of the SIMD width
+    // Execute tests
+    cout << "\t- " << "test batch keys match single hand keys...";
+    for (int n = 0; n < num_boards; n++)
+    {
+        deck.shuffle_deck();
+        vector<Card> board;
+        for (int i = 0; i < n % 6; i++) { board.push_back(deck.deal_one_card()); }
+        vector<std::pair<Card, Card>> hole_cards;
+        for (int i = 0; i < num_hands; i++)
+        {
+            Card c1 = deck.deal_one_card();
+            hole_cards.push_back({ c1, deck.deal_one_card() });
+        }
+        vector<std::uint32_t> keys = evaluate_hands(board, hole_cards);
+        assert((keys.size() == hole_cards.size()) &&
+            "Batch must return one key per hand!");
+        for (int i = 0; i < num_hands; i++)
+        {
+            vector<Card> cards = board;
+            cards.push_back(hole_cards[i].first);
+            cards.push_back(hole_cards[i].second);
+            assert((keys[i] == evaluate_hand(cards).key) &&
+                "Batch key does not match single hand key!");
+        }
+    }
+    cout << "\tPASS" << endl;
+}
+
 /* Run Tests
 ******************************************************************************/
 int main()
@@ -681,6 +945,12 @@ int main()
     test_two_pair();
     test_one_pair();
     test_high_card();
+    test_hand_strength_order();
+    test_random_seven_card_hands();
+    test_card_index();
+    test_lazy_deal();
+    test_board_prefix_hand();
+    test_batch_evaluation();
     cout << endl << "\nAll tests completed successfully!\n" << endl;
 
     return 0;
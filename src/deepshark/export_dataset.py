@@ -0,0 +1,50 @@
+"""Script to convert recorded tournaments into one neural network dataset."""
+# Imports
+###############################################################################
+# Standard system imports
+import ctypes
+# Related third party imports
+import numpy as np
+# Local application/library specific imports
+
+# Initialize C shared library
+###############################################################################
+# Location of C shared library
+c_lib = ctypes.CDLL("src/Cpp/lib/lib_deepshark.so")
+
+# Initialize C function to export the dataset
+###############################################################################
+export_nn_dataset = c_lib.export_nn_dataset
+export_nn_dataset.argtypes = [
+    ctypes.POINTER(ctypes.c_char),
+    ctypes.POINTER(ctypes.c_char),
+    ctypes.c_uint,
+]
+export_nn_dataset.restype = ctypes.c_size_t
+
+# Configure export parameters
+###############################################################################
+# Directory searched recursively for tourn_*.bin files
+directory = "recorded_games"
+tourn_directory = ctypes.c_char_p(directory.encode("utf-8"))
+# Dataset file to create (overwritten if it exists)
+filename = "recorded_games/nn_dataset.bin"
+write_filename = ctypes.c_char_p(filename.encode("utf-8"))
+# Number of physical processors to convert files on
+num_processors = ctypes.c_uint(4)
+
+# Export dataset
+###############################################################################
+num_rows = export_nn_dataset(tourn_directory, write_filename, num_processors)
+print(num_rows)
+
+# Map dataset without copying it
+###############################################################################
+# 64 byte header followed by a num_rows x num_columns float32 array
+header = np.fromfile(filename, dtype=np.uint32, count=8)
+assert header[:1].tobytes() == b"DSNN"
+num_columns, num_inputs = int(header[4]), int(header[5])
+data = np.memmap(filename, dtype=np.float32, mode="r", offset=64,
+                 shape=(num_rows, num_columns))
+inputs, labels = data[:, :num_inputs], data[:, num_inputs:]
+print(f"Feature schema version {header[3]}: {inputs.shape} {labels.shape}")
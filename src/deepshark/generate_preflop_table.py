@@ -0,0 +1,43 @@
+"""Script to generate the preflop equity table used by the heuristic AI."""
+# Imports
+###############################################################################
+# Standard system imports
+import ctypes
+import os
+# Related third party imports
+# Local application/library specific imports
+
+# Initialize C shared library
+###############################################################################
+# Location of C shared library
+c_lib = ctypes.CDLL("src/Cpp/lib/lib_deepshark.so")
+
+# Initialize C function to generate preflop equity table
+###############################################################################
+generate_preflop_table = c_lib.generate_preflop_table
+generate_preflop_table.argtypes = [
+    ctypes.POINTER(ctypes.c_char),
+    ctypes.c_int,
+    ctypes.c_int,
+    ctypes.c_uint,
+]
+generate_preflop_table.restype = ctypes.c_int
+
+# Configure table parameters
+###############################################################################
+# Path the heuristic AI loads the table from (relative to working directory)
+filename = "recorded_games/tables/preflop_equity.bin"
+os.makedirs(os.path.dirname(filename), exist_ok=True)
+b_filename = filename.encode("utf-8")  # create byte objects from the strings
+table_filename = ctypes.c_char_p(b_filename)
+# Number of simulated deals per hole card class and player count
+num_runs = ctypes.c_int(100000)
+# Random seed used to generate the table
+seed = ctypes.c_int(0)
+# Number of physical processors to run simulations on
+num_processors = ctypes.c_uint(4)
+
+# Generate table
+###############################################################################
+result = generate_preflop_table(table_filename, num_runs, seed, num_processors)
+print(result)